@@ -0,0 +1,190 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PRIVATE_SOCI_DECIMAL_H_INCLUDED
+#define SOCI_PRIVATE_SOCI_DECIMAL_H_INCLUDED
+
+#include "soci/error.h"
+#include "soci/type-wrappers.h"
+
+#include <cstddef>
+#include <string>
+
+namespace soci
+{
+
+namespace details
+{
+
+// Maximal scale of decimal values: this is the number of decimal digits that
+// always fit into the 64 bit value.
+int const max_decimal_scale = 18;
+
+// Size of the buffer needed by format_decimal(): sign, up to 20 digits
+// including the leading zero, the decimal point and the trailing NUL.
+std::size_t const decimal_buffer_size = 24;
+
+// Parse the decimal number in "C" locale, optionally using exponential
+// notation, without going through double, so that no precision is lost.
+//
+// Throws if the string is not a number or if it can't be represented as
+// decimal, i.e. if it has too many significant digits.
+inline
+void parse_decimal(char const * s, decimal & d)
+{
+    char const * p = s;
+
+    bool const negative = *p == '-';
+    if (*p == '-' || *p == '+')
+        ++p;
+
+    // Find the end of the digits before and after the decimal point first,
+    // to be able to ignore the trailing zeroes in the fractional part if the
+    // number doesn't fit otherwise.
+    char const * const intStart = p;
+    while (*p >= '0' && *p <= '9')
+        ++p;
+    char const * const intEnd = p;
+
+    char const * fracStart = p;
+    char const * fracEnd = p;
+    if (*p == '.')
+    {
+        fracStart = ++p;
+        while (*p >= '0' && *p <= '9')
+            ++p;
+        fracEnd = p;
+    }
+
+    if (intStart == intEnd && fracStart == fracEnd)
+    {
+        throw soci_error(std::string("Cannot convert data: string \"") + s +
+                         "\" is not a number.");
+    }
+
+    int exponent = 0;
+    if (*p == 'e' || *p == 'E')
+    {
+        ++p;
+        bool const negativeExp = *p == '-';
+        if (*p == '-' || *p == '+')
+            ++p;
+
+        char const * const expStart = p;
+        while (*p >= '0' && *p <= '9' && exponent < 10000)
+            exponent = exponent * 10 + (*p++ - '0');
+
+        if (p == expStart)
+        {
+            throw soci_error(std::string("Cannot convert data: string \"") +
+                             s + "\" is not a number.");
+        }
+
+        if (negativeExp)
+            exponent = -exponent;
+    }
+
+    if (*p != '\0')
+    {
+        throw soci_error(std::string("Cannot convert data: string \"") + s +
+                         "\" is not a number.");
+    }
+
+    int scale = static_cast<int>(fracEnd - fracStart) - exponent;
+    while (scale > max_decimal_scale && fracEnd != fracStart
+            && fracEnd[-1] == '0')
+    {
+        --fracEnd;
+        --scale;
+    }
+
+    unsigned long long const limit = negative
+        ? 9223372036854775808ULL
+        : 9223372036854775807ULL;
+
+    bool overflow = scale > max_decimal_scale;
+    unsigned long long value = 0;
+    for (char const * q = intStart; q != fracEnd && !overflow; ++q)
+    {
+        if (q == intEnd)
+            q = fracStart;
+        if (q == fracEnd)
+            break;
+
+        unsigned const digit = static_cast<unsigned>(*q - '0');
+        if (value > (limit - digit) / 10)
+            overflow = true;
+        else
+            value = value * 10 + digit;
+    }
+
+    // Positive exponent may require adding zeroes to the value.
+    for (; scale < 0 && !overflow; ++scale)
+    {
+        if (value > limit / 10)
+            overflow = true;
+        else
+            value *= 10;
+    }
+
+    if (overflow)
+    {
+        throw soci_error(std::string("Cannot convert data: value \"") + s +
+                         "\" is out of range for decimal.");
+    }
+
+    d.value = negative
+        ? static_cast<long long>(0ULL - value)
+        : static_cast<long long>(value);
+    d.scale = scale;
+}
+
+// Format the decimal using point as decimal separator and writing exactly
+// scale digits after it. Returns the length of the string stored in the
+// buffer, which must be at least decimal_buffer_size bytes long.
+inline
+std::size_t format_decimal(char * buf, decimal const & d)
+{
+    if (d.scale < 0 || d.scale > max_decimal_scale)
+    {
+        throw soci_error("Decimal scale out of range.");
+    }
+
+    unsigned long long value = static_cast<unsigned long long>(d.value);
+    if (d.value < 0)
+        value = 0ULL - value;
+
+    // Write the digits in reverse order first, padding them with zeroes to
+    // have at least one digit before the decimal point.
+    char digits[decimal_buffer_size];
+    int n = 0;
+    do
+    {
+        digits[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    while (value != 0 || n <= d.scale);
+
+    char * p = buf;
+    if (d.value < 0)
+        *p++ = '-';
+
+    while (n > 0)
+    {
+        if (n == d.scale)
+            *p++ = '.';
+        *p++ = digits[--n];
+    }
+    *p = '\0';
+
+    return static_cast<std::size_t>(p - buf);
+}
+
+} // namespace details
+
+} // namespace soci
+
+#endif // SOCI_PRIVATE_SOCI_DECIMAL_H_INCLUDED
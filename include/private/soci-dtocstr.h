@@ -26,15 +26,18 @@ namespace details
 // The resulting string will contain the floating point number in "C" locale,
 // i.e. will always use point as decimal separator independently of the current
 // locale.
+//
+// The default precision preserves the exact binary value, use a smaller one,
+// e.g. 15, to get the shortest decimal representation of most numbers.
 inline
-std::string double_to_cstring(double d)
+std::string double_to_cstring(double d, int precision = 20)
 {
     // See comments in cstring_to_double() in soci-cstrtod.h, we're dealing
     // with the same issues here.
 
     static size_t const bufSize = 32;
     char buf[bufSize];
-    snprintf(buf, bufSize, "%.20g", d);
+    snprintf(buf, bufSize, "%.*g", precision, d);
 
     // Replace any commas which can be used as decimal separator with points.
     for (char* p = buf; *p != '\0'; p++ )
@@ -10,6 +10,7 @@
 
 #include "soci/soci-backend.h"
 #include "soci/type-wrappers.h"
+#include "soci/packed-strings.h"
 
 #include <ctime>
 
@@ -82,6 +83,30 @@ struct exchange_type_traits<x_xmltype>
   typedef xml_type value_type;
 };
 
+template <>
+struct exchange_type_traits<x_stringref>
+{
+  typedef string_ref value_type;
+};
+
+template <>
+struct exchange_type_traits<x_packedstrings>
+{
+  typedef packed_strings value_type;
+};
+
+template <>
+struct exchange_type_traits<x_timestamp>
+{
+  typedef timestamp value_type;
+};
+
+template <>
+struct exchange_type_traits<x_decimal>
+{
+  typedef decimal value_type;
+};
+
 // exchange_type_traits not defined for x_statement, x_rowid and x_blob here.
 
 template <exchange_type e>
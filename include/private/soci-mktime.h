@@ -8,9 +8,13 @@
 #ifndef SOCI_PRIVATE_SOCI_MKTIME_H_INCLUDED
 #define SOCI_PRIVATE_SOCI_MKTIME_H_INCLUDED
 
+#include "soci/type-wrappers.h"
+
 // Not <ctime> because we also want to get timegm() if available.
 #include <time.h>
 
+#include <cstddef>
+
 namespace soci
 {
 
@@ -44,6 +48,104 @@ mktime_from_ymdhms(tm& t,
 // Throws if the string in buf couldn't be parsed as a date or a time string.
 SOCI_DECL void parse_std_tm(char const *buf, std::tm &t);
 
+// Return the number of days between 1970-01-01 and the given date in the
+// proleptic Gregorian calendar, the result is negative for earlier dates.
+//
+// This is a direct computation, unlike mktime() it doesn't depend on the
+// current time zone and doesn't normalize its arguments.
+inline
+long long
+days_from_civil(int year, int month, int day)
+{
+    if (month <= 2)
+        --year;
+
+    long long const era = (year >= 0 ? year : year - 399) / 400;
+    long long const yoe = year - era * 400;
+    long long const doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5
+                            + day - 1;
+    long long const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + doe - 719468;
+}
+
+// Inverse of days_from_civil().
+inline
+void
+civil_from_days(long long days, int& year, int& month, int& day)
+{
+    days += 719468;
+
+    long long const era = (days >= 0 ? days : days - 146096) / 146097;
+    long long const doe = days - era * 146097;
+    long long const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    long long const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    long long const mp = (5 * doy + 2) / 153;
+
+    day = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+    month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    year = static_cast<int>(yoe + era * 400 + (month <= 2 ? 1 : 0));
+}
+
+// Return the number of microseconds since the Unix epoch for the given UTC
+// date and time, using 1-based years and months as mktime_from_ymdhms().
+inline
+long long
+timestamp_from_ymdhms(int year, int month, int day,
+                      int hour, int minute, int second, int microsecond)
+{
+    long long const seconds =
+        ((days_from_civil(year, month, day) * 24 + hour) * 60 + minute) * 60
+            + second;
+
+    return seconds * 1000000 + microsecond;
+}
+
+// Inverse of timestamp_from_ymdhms().
+inline
+void
+timestamp_to_ymdhms(long long microseconds,
+                    int& year, int& month, int& day,
+                    int& hour, int& minute, int& second, int& microsecond)
+{
+    long long const usPerDay = 86400LL * 1000000;
+
+    long long days = microseconds / usPerDay;
+    long long rest = microseconds % usPerDay;
+    if (rest < 0)
+    {
+        rest += usPerDay;
+        --days;
+    }
+
+    civil_from_days(days, year, month, day);
+
+    microsecond = static_cast<int>(rest % 1000000);
+    rest /= 1000000;
+    second = static_cast<int>(rest % 60);
+    rest /= 60;
+    minute = static_cast<int>(rest % 60);
+    hour = static_cast<int>(rest / 60);
+}
+
+// Parse a date/time value in ISO 8601-like "YYYY-MM-DD HH:MM:SS.ffffff"
+// format, in which either the date or the time part may be omitted as well
+// as the fractional seconds. The value may be followed by a time zone offset
+// ("Z", "+HH", "+HH:MM" or "+HHMM"), in which case it is converted to UTC.
+//
+// Unlike parse_std_tm(), this function doesn't lose the fractional seconds
+// and doesn't use the C library calendar functions.
+//
+// Throws if the string in buf couldn't be parsed as a date or a time string.
+SOCI_DECL void parse_timestamp(char const *buf, timestamp &ts);
+
+// Size of the buffer sufficient for format_timestamp() output.
+std::size_t const timestamp_buffer_size = 32;
+
+// Format the timestamp as "YYYY-MM-DD HH:MM:SS[.ffffff]", with the fractional
+// part only present if it's non-zero, and return the length of the string.
+SOCI_DECL std::size_t format_timestamp(char *buf, timestamp const &ts);
+
 } // namespace details
 
 } // namespace soci
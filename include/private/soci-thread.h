@@ -0,0 +1,213 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PRIVATE_SOCI_THREAD_H_INCLUDED
+#define SOCI_PRIVATE_SOCI_THREAD_H_INCLUDED
+
+#include "soci/error.h"
+#include "soci/soci-platform.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#else
+#include <windows.h>
+#endif
+
+namespace soci
+{
+
+namespace details
+{
+
+// Minimal portable synchronization primitives and threads used internally.
+
+class mutex
+{
+public:
+    mutex()
+    {
+#ifndef _WIN32
+        if (pthread_mutex_init(&mtx_, NULL) != 0)
+        {
+            throw soci_error("Synchronization error");
+        }
+#else
+        InitializeCriticalSection(&mtx_);
+#endif
+    }
+
+    ~mutex()
+    {
+#ifndef _WIN32
+        pthread_mutex_destroy(&mtx_);
+#else
+        DeleteCriticalSection(&mtx_);
+#endif
+    }
+
+    void lock()
+    {
+#ifndef _WIN32
+        if (pthread_mutex_lock(&mtx_) != 0)
+        {
+            throw soci_error("Synchronization error");
+        }
+#else
+        EnterCriticalSection(&mtx_);
+#endif
+    }
+
+    void unlock()
+    {
+#ifndef _WIN32
+        pthread_mutex_unlock(&mtx_);
+#else
+        LeaveCriticalSection(&mtx_);
+#endif
+    }
+
+private:
+    friend class condition;
+
+#ifndef _WIN32
+    pthread_mutex_t mtx_;
+#else
+    CRITICAL_SECTION mtx_;
+#endif
+
+    SOCI_NOT_COPYABLE(mutex)
+};
+
+class scoped_lock
+{
+public:
+    explicit scoped_lock(mutex & m) : m_(m) { m_.lock(); }
+    ~scoped_lock() { m_.unlock(); }
+
+private:
+    mutex & m_;
+
+    SOCI_NOT_COPYABLE(scoped_lock)
+};
+
+class condition
+{
+public:
+    condition()
+    {
+#ifndef _WIN32
+        if (pthread_cond_init(&cond_, NULL) != 0)
+        {
+            throw soci_error("Synchronization error");
+        }
+#else
+        InitializeConditionVariable(&cond_);
+#endif
+    }
+
+    ~condition()
+    {
+#ifndef _WIN32
+        pthread_cond_destroy(&cond_);
+#endif
+    }
+
+    // The mutex must be locked when calling this function.
+    void wait(mutex & m)
+    {
+#ifndef _WIN32
+        pthread_cond_wait(&cond_, &m.mtx_);
+#else
+        SleepConditionVariableCS(&cond_, &m.mtx_, INFINITE);
+#endif
+    }
+
+    void notify_all()
+    {
+#ifndef _WIN32
+        pthread_cond_broadcast(&cond_);
+#else
+        WakeAllConditionVariable(&cond_);
+#endif
+    }
+
+private:
+#ifndef _WIN32
+    pthread_cond_t cond_;
+#else
+    CONDITION_VARIABLE cond_;
+#endif
+
+    SOCI_NOT_COPYABLE(condition)
+};
+
+// Thread executing the given function with the given argument.
+class thread
+{
+public:
+    typedef void (*function)(void * arg);
+
+    thread(function func, void * arg)
+        : func_(func), arg_(arg)
+    {
+#ifndef _WIN32
+        if (pthread_create(&thread_, NULL, &thread::entry, this) != 0)
+        {
+            throw soci_error("Failed to create thread");
+        }
+#else
+        thread_ = CreateThread(NULL, 0, &thread::entry, this, 0, NULL);
+        if (thread_ == NULL)
+        {
+            throw soci_error("Failed to create thread");
+        }
+#endif
+    }
+
+    // Wait for the thread termination, this must be done before destroying
+    // this object.
+    void join()
+    {
+#ifndef _WIN32
+        pthread_join(thread_, NULL);
+#else
+        WaitForSingleObject(thread_, INFINITE);
+        CloseHandle(thread_);
+#endif
+    }
+
+private:
+#ifndef _WIN32
+    static void * entry(void * self)
+    {
+        thread * const t = static_cast<thread *>(self);
+        t->func_(t->arg_);
+        return NULL;
+    }
+
+    pthread_t thread_;
+#else
+    static DWORD WINAPI entry(LPVOID self)
+    {
+        thread * const t = static_cast<thread *>(self);
+        t->func_(t->arg_);
+        return 0;
+    }
+
+    HANDLE thread_;
+#endif
+
+    function func_;
+    void * arg_;
+
+    SOCI_NOT_COPYABLE(thread)
+};
+
+} // namespace details
+
+} // namespace soci
+
+#endif // SOCI_PRIVATE_SOCI_THREAD_H_INCLUDED
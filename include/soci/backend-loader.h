@@ -19,8 +19,12 @@ namespace soci
 namespace dynamic_backends
 {
 
-// used internally by session
+// used internally by connection_parameters: get() loads the backend if
+// necessary and adds a reference to it, which must be released later, and
+// the library providing it is not unloaded while there are any references
 backend_factory const & get(std::string const & name);
+void add_ref(backend_factory const & factory);
+void release(backend_factory const & factory);
 
 // provided for advanced user-level management
 SOCI_DECL std::vector<std::string> & search_paths();
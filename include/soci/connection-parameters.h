@@ -27,7 +27,11 @@ public:
     connection_parameters(std::string const & backendName, std::string const & connectString);
     explicit connection_parameters(std::string const & fullConnectString);
 
-    // Default copy ctor, assignment operator and dtor are all OK for us.
+    // Copying the object keeps the dynamically loaded backend, if any, loaded
+    // until all the copies are destroyed.
+    connection_parameters(connection_parameters const & other);
+    connection_parameters & operator=(connection_parameters const & other);
+    ~connection_parameters();
 
 
     // Retrieve the backend and the connection strings specified in the ctor.
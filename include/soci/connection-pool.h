@@ -29,6 +29,9 @@ public:
     bool try_lease(std::size_t & pos, int timeout);
     void give_back(std::size_t pos);
 
+    // Return the number of sessions not currently leased.
+    std::size_t get_free_count() const;
+
 private:
     struct connection_pool_impl;
     connection_pool_impl * pimpl_;
@@ -256,6 +256,12 @@ struct db2_session_backend : details::session_backend
     void commit() SOCI_OVERRIDE;
     void rollback() SOCI_OVERRIDE;
 
+    std::string set_savepoint(const std::string & name) SOCI_OVERRIDE
+    {
+        // DB2 requires specifying the behaviour of the open cursors.
+        return "savepoint " + name + " on rollback retain cursors";
+    }
+
     std::string get_dummy_from_table() const SOCI_OVERRIDE { return "sysibm.sysdummy1"; }
 
     std::string get_backend_name() const SOCI_OVERRIDE { return "DB2"; }
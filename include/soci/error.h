@@ -50,6 +50,7 @@ public:
         constraint_violation,
         unknown_transaction_state,
         system_error,
+        limit_exceeded,
         unknown
     };
 
@@ -61,6 +62,19 @@ private:
     class soci_error_extra_info* info_;
 };
 
+// Thrown when fetching the rows would need to buffer more memory than
+// allowed by session::set_fetch_memory_limit().
+class SOCI_DECL memory_limit_error : public soci_error
+{
+public:
+    explicit memory_limit_error(std::string const & msg) : soci_error(msg) {}
+
+    error_category get_error_category() const SOCI_OVERRIDE
+    {
+        return limit_exceeded;
+    }
+};
+
 } // namespace soci
 
 #endif // SOCI_ERROR_H_INCLUDED
@@ -148,6 +148,27 @@ struct exchange_traits<long_string>
     enum { x_type = x_longstring };
 };
 
+template <>
+struct exchange_traits<string_ref>
+{
+    typedef basic_type_tag type_family;
+    enum { x_type = x_stringref };
+};
+
+template <>
+struct exchange_traits<timestamp>
+{
+    typedef basic_type_tag type_family;
+    enum { x_type = x_timestamp };
+};
+
+template <>
+struct exchange_traits<decimal>
+{
+    typedef basic_type_tag type_family;
+    enum { x_type = x_decimal };
+};
+
 } // namespace details
 
 } // namespace soci
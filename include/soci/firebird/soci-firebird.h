@@ -110,6 +110,7 @@ struct firebird_vector_into_type_backend : details::vector_into_type_backend
     void clean_up() SOCI_OVERRIDE;
 
     firebird_statement_backend &statement_;
+    virtual void startFetch();
     virtual void exchangeData(std::size_t row);
 
     void *data_;
@@ -235,8 +236,8 @@ protected:
 
     virtual void exchangeData(bool gotData, int row);
     virtual void prepareSQLDA(XSQLDA ** sqldap, short size = 10);
-    virtual void rewriteQuery(std::string const & query,
-        std::vector<char> & buffer);
+    virtual void prepareQuery(std::string const & query);
+    virtual void doPrepare(std::vector<char> & buffer);
     virtual void rewriteParameters(std::string const & src,
         std::vector<char> & dst);
 
@@ -297,11 +298,36 @@ protected:
         std::size_t toWrite);
     virtual void cleanUp();
 
-    // buffer for BLOB data
+    void closeHandle();
+    void ensureBuffered();
+    std::size_t readStream(std::size_t offset, char * buf,
+        std::size_t toRead);
+    std::size_t readSegments(char * buf, std::size_t toRead);
+    void seek(std::size_t offset);
+    void createBlob();
+    void startWriting();
+    void finishWriting();
+    void putSegments(char const * buf, std::size_t size);
+
+    // buffer for BLOB data, only used if it is modified in other ways than
+    // by appending to it
     std::vector<char> data_;
 
+    // BLOB data was loaded into data_ (true)
     bool loaded_;
     long max_seg_size_;
+
+    // total length of the BLOB in the database or of the data written so far
+    std::size_t len_;
+
+    // current position of the read handle
+    std::size_t pos_;
+
+    // BLOB in the database is a stream BLOB supporting seeking
+    bool stream_;
+
+    // bhp_ refers to a new BLOB being written
+    bool writing_;
 };
 
 struct firebird_session_backend : details::session_backend
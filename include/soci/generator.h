@@ -0,0 +1,494 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_GENERATOR_H_INCLUDED
+#define SOCI_GENERATOR_H_INCLUDED
+
+#include "soci/soci-platform.h"
+
+#ifdef SOCI_HAVE_COROUTINES
+
+#include "soci/into.h"
+#include "soci/prepare-temp-type.h"
+#include "soci/row.h"
+#include "soci/statement.h"
+// std
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace soci
+{
+
+//
+// Coroutine lazily producing a sequence of values, which are yielded by
+// reference and so are only valid until the iterator is incremented.
+//
+template <typename T>
+class generator
+{
+public:
+    class promise_type
+    {
+    public:
+        generator get_return_object() noexcept
+        {
+            return generator(handle_type::from_promise(*this));
+        }
+
+        // Don't do anything, e.g. execute the query, until the first value
+        // is requested.
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        std::suspend_always yield_value(T & value) noexcept
+        {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() noexcept
+        {
+            exception_ = std::current_exception();
+        }
+
+        // Generators only yield values and can't wait for anything.
+        template <typename U>
+        std::suspend_never await_transform(U &&) = delete;
+
+        T & value() const noexcept { return *value_; }
+
+        void rethrow_if_failed()
+        {
+            if (exception_)
+            {
+                std::rethrow_exception(std::exchange(exception_, nullptr));
+            }
+        }
+
+    private:
+        T * value_ = nullptr;
+        std::exception_ptr exception_;
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    class iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+        typedef std::ptrdiff_t difference_type;
+
+        iterator() noexcept = default;
+
+        reference operator*() const noexcept
+        {
+            return coro_.promise().value();
+        }
+
+        pointer operator->() const noexcept
+        {
+            return std::addressof(operator*());
+        }
+
+        iterator & operator++()
+        {
+            coro_.resume();
+            coro_.promise().rethrow_if_failed();
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const noexcept
+        {
+            return !coro_ || coro_.done();
+        }
+
+    private:
+        friend class generator;
+
+        explicit iterator(handle_type coro) noexcept : coro_(coro) {}
+
+        handle_type coro_;
+    };
+
+    generator(generator && other) noexcept
+        : coro_(std::exchange(other.coro_, nullptr))
+    {}
+
+    generator & operator=(generator && other) noexcept
+    {
+        if (&other != this)
+        {
+            if (coro_)
+            {
+                coro_.destroy();
+            }
+
+            coro_ = std::exchange(other.coro_, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~generator()
+    {
+        // This also destroys the statement if the iteration was interrupted.
+        if (coro_)
+        {
+            coro_.destroy();
+        }
+    }
+
+    // Start the iteration: this can be done only once as the sequence can't
+    // be restarted.
+    iterator begin()
+    {
+        if (coro_)
+        {
+            coro_.resume();
+            coro_.promise().rethrow_if_failed();
+        }
+
+        return iterator(coro_);
+    }
+
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+    explicit generator(handle_type coro) noexcept : coro_(coro) {}
+
+    handle_type coro_;
+
+    SOCI_NOT_COPYABLE(generator)
+};
+
+//
+// Execute the prepared query and yield its rows one by one, e.g.
+//
+//      for (row const & r : stream_rows(sql.prepare << "select * from t"))
+//          ...
+//
+// The query is only executed when the iteration starts and the session must
+// remain alive until the generator is destroyed. Just as rowset, this doesn't
+// allow using explicit into elements with the query.
+//
+template <typename T = row>
+generator<T> stream_rows(details::prepare_temp_type prep)
+{
+    statement st(prep);
+
+    T define;
+    st.exchange_for_rowset(into(define));
+    st.execute();
+
+    while (st.fetch())
+    {
+        co_yield define;
+    }
+}
+
+//
+// Execute the prepared query and yield its rows in batches of at most the
+// given size, which are fetched using a single round-trip to the database
+// with the backends supporting bulk operations. The vector may be modified,
+// e.g. swapped with another one, before requesting the next batch.
+//
+template <typename T>
+generator<std::vector<T> > stream_batches(details::prepare_temp_type prep,
+    std::size_t batchSize)
+{
+    if (batchSize == 0)
+    {
+        throw soci_error("Invalid batch size");
+    }
+
+    statement st(prep);
+
+    std::vector<T> batch(batchSize);
+    st.exchange_for_rowset(into(batch));
+    st.execute();
+
+    while (st.fetch())
+    {
+        co_yield batch;
+
+        batch.resize(batchSize);
+    }
+}
+
+//
+// Object which can be awaited by async_generator coroutines to suspend them
+// until the result of the statement executed or fetched next is available.
+//
+class result_ready
+{
+public:
+    // The socket is the one returned by statement::start_execute(), if it is
+    // -1, the statement is executed synchronously and nothing is awaited.
+    result_ready(statement & st, int socket) noexcept
+        : st_(&st), socket_(socket)
+    {}
+
+    bool is_ready() const
+    {
+        return socket_ == -1 || !st_->is_result_pending();
+    }
+
+    int get_socket() const noexcept { return socket_; }
+
+private:
+    statement * st_;
+    int socket_;
+};
+
+//
+// Coroutine producing a sequence of values without blocking while waiting
+// for the database, which allows a single thread to stream the results of
+// many queries, executed using different sessions, concurrently.
+//
+// Unlike generator, it can't be iterated over but must be polled: poll()
+// returns false while the coroutine waits for the database, in which case
+// socket() must become readable before it's worth calling poll() again.
+//
+template <typename T>
+class async_generator
+{
+public:
+    class promise_type;
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    class promise_type
+    {
+    public:
+        async_generator get_return_object() noexcept
+        {
+            return async_generator(handle_type::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        std::suspend_always yield_value(T & value) noexcept
+        {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() noexcept
+        {
+            exception_ = std::current_exception();
+        }
+
+        class awaiter
+        {
+        public:
+            awaiter(promise_type & promise, result_ready const & ready)
+                : promise_(promise), ready_(ready)
+            {}
+
+            bool await_ready() const { return ready_.is_ready(); }
+
+            void await_suspend(handle_type) const noexcept
+            {
+                promise_.waiting_ = ready_;
+            }
+
+            void await_resume() const noexcept {}
+
+        private:
+            promise_type & promise_;
+            result_ready const ready_;
+        };
+
+        // As this is the only await_transform() overload, only waiting for
+        // the results of the statements is allowed.
+        awaiter await_transform(result_ready const & ready) noexcept
+        {
+            return awaiter(*this, ready);
+        }
+
+        T & value() const noexcept { return *value_; }
+
+        std::optional<result_ready> const & waiting() const noexcept
+        {
+            return waiting_;
+        }
+
+        void resume(handle_type coro)
+        {
+            waiting_.reset();
+            value_ = nullptr;
+            coro.resume();
+
+            if (exception_)
+            {
+                std::rethrow_exception(std::exchange(exception_, nullptr));
+            }
+        }
+
+    private:
+        T * value_ = nullptr;
+        std::optional<result_ready> waiting_;
+        std::exception_ptr exception_;
+    };
+
+    async_generator(async_generator && other) noexcept
+        : coro_(std::exchange(other.coro_, nullptr))
+    {}
+
+    async_generator & operator=(async_generator && other) noexcept
+    {
+        if (&other != this)
+        {
+            if (coro_)
+            {
+                coro_.destroy();
+            }
+
+            coro_ = std::exchange(other.coro_, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~async_generator()
+    {
+        if (coro_)
+        {
+            coro_.destroy();
+        }
+    }
+
+    // Advance to the next value unless the coroutine still needs to wait for
+    // the database: returns true if either a new value is available or the
+    // sequence is exhausted and false if it would block.
+    bool poll()
+    {
+        if (!coro_ || coro_.done())
+        {
+            return true;
+        }
+
+        promise_type & promise = coro_.promise();
+        if (promise.waiting() && !promise.waiting()->is_ready())
+        {
+            return false;
+        }
+
+        promise.resume(coro_);
+
+        return !promise.waiting();
+    }
+
+    bool done() const noexcept { return !coro_ || coro_.done(); }
+
+    // Return the current value, can only be called after poll() returned
+    // true and if done() is false.
+    T & value() const noexcept { return coro_.promise().value(); }
+
+    // Return the socket to wait on before calling poll() again after it
+    // returned false.
+    int socket() const noexcept
+    {
+        if (!coro_ || !coro_.promise().waiting())
+        {
+            return -1;
+        }
+
+        return coro_.promise().waiting()->get_socket();
+    }
+
+private:
+    explicit async_generator(handle_type coro) noexcept : coro_(coro) {}
+
+    handle_type coro_;
+
+    SOCI_NOT_COPYABLE(async_generator)
+};
+
+//
+// Asynchronous counterpart of stream_rows(): the query is sent to the server
+// without waiting for its result if the backend supports it (currently only
+// PostgreSQL does) and otherwise executed synchronously by the first poll().
+//
+template <typename T = row>
+async_generator<T> async_stream_rows(details::prepare_temp_type prep)
+{
+    statement st(prep);
+
+    T define;
+    st.exchange_for_rowset(into(define));
+
+    int const socket = st.start_execute();
+    co_await result_ready(st, socket);
+    st.execute();
+
+    for (;;)
+    {
+        co_await result_ready(st, socket);
+        if (!st.fetch())
+        {
+            break;
+        }
+
+        co_yield define;
+    }
+}
+
+//
+// Asynchronous counterpart of stream_batches().
+//
+template <typename T>
+async_generator<std::vector<T> > async_stream_batches(
+    details::prepare_temp_type prep, std::size_t batchSize)
+{
+    if (batchSize == 0)
+    {
+        throw soci_error("Invalid batch size");
+    }
+
+    statement st(prep);
+
+    std::vector<T> batch(batchSize);
+    st.exchange_for_rowset(into(batch));
+
+    int const socket = st.start_execute();
+    co_await result_ready(st, socket);
+    st.execute();
+
+    for (;;)
+    {
+        co_await result_ready(st, socket);
+        if (!st.fetch())
+        {
+            break;
+        }
+
+        co_yield batch;
+
+        batch.resize(batchSize);
+    }
+}
+
+} // namespace soci
+
+#endif // SOCI_HAVE_COROUTINES
+
+#endif // SOCI_GENERATOR_H_INCLUDED
@@ -27,6 +27,7 @@ class prepare_temp_type;
 class standard_into_type_backend;
 class vector_into_type_backend;
 class statement_impl;
+struct cached_value;
 
 // this is intended to be a base class for all classes that deal with
 // defining output data
@@ -43,6 +44,18 @@ public:
 
     virtual std::size_t size() const = 0;  // returns the number of elements
     virtual void resize(std::size_t /* sz */) {} // used for vectors only
+
+    // used by the result cache: save the fetched value and restore it later
+    // instead of fetching it, both return false if this is impossible
+    virtual bool save_to_cache(cached_value & /* v */) const { return false; }
+    virtual bool load_from_cache(cached_value const & /* v */)
+    { return false; }
+
+    // used when the session reconnects: release the backend objects created
+    // for the old connection and define the element again for the new one,
+    // elements not owning any backend objects don't need to do anything
+    virtual void release_backend() {}
+    virtual void redefine(statement_impl & /* st */, int & /* position */) {}
 };
 
 typedef type_ptr<into_type_base> into_type_ptr;
@@ -59,6 +72,13 @@ public:
 
     ~standard_into_type() SOCI_OVERRIDE;
 
+    bool save_to_cache(cached_value & v) const SOCI_OVERRIDE;
+    bool load_from_cache(cached_value const & v) SOCI_OVERRIDE;
+
+    void release_backend() SOCI_OVERRIDE;
+    void redefine(statement_impl & st, int & position) SOCI_OVERRIDE
+    { define(st, position); }
+
 protected:
     void post_fetch(bool gotData, bool calledFromFetch) SOCI_OVERRIDE;
 
@@ -106,6 +126,10 @@ public:
 
     ~vector_into_type() SOCI_OVERRIDE;
 
+    void release_backend() SOCI_OVERRIDE;
+    void redefine(statement_impl & st, int & position) SOCI_OVERRIDE
+    { define(st, position); }
+
 protected:
     void post_fetch(bool gotData, bool calledFromFetch) SOCI_OVERRIDE;
 
@@ -160,6 +160,7 @@ struct mysql_statement_backend : details::statement_backend
     int prepare_for_describe() SOCI_OVERRIDE;
     void describe_column(int colNum, data_type &dtype,
         std::string &columnName) SOCI_OVERRIDE;
+    bool has_data_independent_types() const SOCI_OVERRIDE { return true; }
 
     mysql_standard_into_type_backend * make_into_type_backend() SOCI_OVERRIDE;
     mysql_standard_use_type_backend * make_use_type_backend() SOCI_OVERRIDE;
@@ -195,6 +196,10 @@ struct mysql_statement_backend : details::statement_backend
     bool hasUseElements_;
     bool hasVectorUseElements_;
 
+    // true if any into or use element is a timestamp, requiring the session
+    // time zone to be switched to UTC before the execution
+    bool hasTimestamps_;
+
     // the following maps are used for finding data buffers according to
     // use elements specified by the user
 
@@ -249,11 +254,18 @@ struct mysql_session_backend : details::session_backend
 
     void clean_up();
 
+    // Switch the session time zone to UTC, in which the timestamp values are
+    // exchanged, if it wasn't done yet for this connection.
+    void use_utc_time_zone();
+
     mysql_statement_backend * make_statement_backend() SOCI_OVERRIDE;
     mysql_rowid_backend * make_rowid_backend() SOCI_OVERRIDE;
     mysql_blob_backend * make_blob_backend() SOCI_OVERRIDE;
 
     MYSQL *conn_;
+
+    // true once the session time zone was switched to UTC
+    bool utcTimeZone_;
 };
 
 
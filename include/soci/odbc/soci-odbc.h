@@ -77,7 +77,12 @@ protected:
     enum
     {
         // This is the length of decimal representation of UINT64_MAX + 1.
-        max_bigint_length = 21
+        max_bigint_length = 21,
+
+        // Maximal length of the string representation of DECIMAL values
+        // fetched as strings: 38 digits, sign, decimal point, leading zero
+        // and the trailing NUL.
+        max_decimal_length = 42
     };
 
     // IBM DB2 driver is not compliant to ODBC spec for indicators in 64bit
@@ -187,7 +192,8 @@ struct odbc_standard_use_type_backend : details::standard_use_type_backend,
 private:
     // Copy string data to buf_ and set size, sqlType and cType to the values
     // appropriate for strings.
-    void copy_from_string(std::string const& s,
+    void copy_from_string(char const* s,
+                          std::size_t len,
                           SQLLEN& size,
                           SQLSMALLINT& sqlType,
                           SQLSMALLINT& cType);
@@ -319,6 +325,10 @@ struct odbc_session_backend : details::session_backend
     bool get_last_insert_id(session & s,
         std::string const & table, long & value) SOCI_OVERRIDE;
 
+    std::string set_savepoint(const std::string & name) SOCI_OVERRIDE;
+    std::string release_savepoint(const std::string & name) SOCI_OVERRIDE;
+    std::string rollback_to_savepoint(const std::string & name) SOCI_OVERRIDE;
+
     std::string get_dummy_from_table() const SOCI_OVERRIDE;
 
     std::string get_backend_name() const SOCI_OVERRIDE { return "odbc"; }
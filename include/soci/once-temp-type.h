@@ -21,6 +21,7 @@ namespace details
 {
 
 class ref_counted_statement;
+struct cached_type;
 
 // this needs to be lightweight and copyable
 class SOCI_DECL once_temp_type
@@ -42,6 +43,7 @@ public:
 
     once_temp_type & operator,(into_type_ptr const &);
     once_temp_type & operator,(use_type_ptr const &);
+    once_temp_type & operator,(cached_type const &);
     
     template <typename T, typename Indicator>
     once_temp_type &operator,(into_container<T, Indicator> const &ic)
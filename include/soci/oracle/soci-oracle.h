@@ -47,6 +47,17 @@ public:
     error_category cat_;
 };
 
+// Error for a single row of an array DML statement executed in the batch
+// errors mode, see oracle_statement_backend::get_batch_errors().
+struct oracle_batch_error
+{
+    // index of the row in the array, i.e. relative to the first used element
+    std::size_t row_;
+
+    std::string message_;
+    int err_num_;
+};
+
 
 struct oracle_statement_backend;
 struct oracle_standard_into_type_backend : details::standard_into_type_backend
@@ -59,6 +70,7 @@ struct oracle_standard_into_type_backend : details::standard_into_type_backend
         void *data, details::exchange_type type) SOCI_OVERRIDE;
 
     void read_from_lob(OCILobLocator * lobp, std::string & value);
+    void set_lob_prefetch();
 
     void pre_exec(int num) SOCI_OVERRIDE;
     void pre_fetch() SOCI_OVERRIDE;
@@ -243,6 +255,7 @@ struct oracle_statement_backend : details::statement_backend
     int prepare_for_describe() SOCI_OVERRIDE;
     void describe_column(int colNum, data_type &dtype,
         std::string &columnName) SOCI_OVERRIDE;
+    bool has_data_independent_types() const SOCI_OVERRIDE { return true; }
 
     // helper for defining into vector<string>
     std::size_t column_size(int position);
@@ -259,6 +272,45 @@ struct oracle_statement_backend : details::statement_backend
     bool boundByName_;
     bool boundByPos_;
     bool noData_;
+
+    // stmtp_ was obtained from the session statement cache
+    bool cached_;
+
+    // Set the number of rows or the amount of memory used for prefetching
+    // rows when fetching them, overriding the session defaults. This avoids
+    // a round trip to the server for each row when not using bulk fetches,
+    // e.g. with rowset. Must be called before executing the statement.
+    void set_prefetch_rows(unsigned rows) { prefetchRows_ = rows; }
+    void set_prefetch_memory(unsigned bytes) { prefetchMemory_ = bytes; }
+
+    // Set the amount of LOB data returned together with the LOB locators,
+    // avoiding a separate round trip to read small LOBs. Must be called
+    // before executing the statement for the first time.
+    void set_lob_prefetch_size(unsigned bytes) { lobPrefetchSize_ = bytes; }
+
+    unsigned prefetchRows_;
+    unsigned prefetchMemory_;
+    unsigned lobPrefetchSize_;
+
+    // Enable or disable the batch errors mode, overriding the session
+    // default. In this mode, the array DML statements are executed for all
+    // rows even if some of them fail and the errors for these rows are
+    // returned by get_batch_errors() instead of throwing an exception.
+    void set_batch_errors(bool batchErrors) { useBatchErrors_ = batchErrors; }
+
+    // Return the errors of the last execution in the batch errors mode.
+    std::vector<oracle_batch_error> const & get_batch_errors() const
+    {
+        return batchErrors_;
+    }
+
+    bool useBatchErrors_;
+    std::vector<oracle_batch_error> batchErrors_;
+
+private:
+    void free_handle();
+    void collect_batch_errors();
+    void set_prefetch_attribute(ub4 attr, ub4 value);
 };
 
 struct oracle_rowid_backend : details::rowid_backend
@@ -313,7 +365,9 @@ struct oracle_session_backend : details::session_backend
         int mode,
         bool decimals_as_strings = false,
         int charset = 0,
-        int ncharset = 0);
+        int ncharset = 0,
+        unsigned stmt_cache_size = 0,
+        unsigned session_pool_size = 0);
 
     ~oracle_session_backend() SOCI_OVERRIDE;
 
@@ -432,6 +486,11 @@ struct oracle_session_backend : details::session_backend
     {
         return "nvl";
     }
+    std::string release_savepoint(const std::string & /* name */) SOCI_OVERRIDE
+    {
+        // Oracle releases savepoints only at the end of the transaction.
+        return std::string();
+    }
 
     std::string get_dummy_from_table() const SOCI_OVERRIDE { return "dual"; }
 
@@ -456,6 +515,27 @@ struct oracle_session_backend : details::session_backend
     OCISvcCtx *svchp_;
     OCISession *usrhp_;
     bool decimals_as_strings_;
+
+    // size of the client-side statement cache, 0 if it's not used
+    unsigned stmtCacheSize_;
+
+    // the session was obtained from an OCI session pool, which owns envhp_
+    bool pooled_;
+
+    // default prefetch options for the statements of this session, 0 means
+    // using OCI defaults
+    unsigned prefetchRows_;
+    unsigned prefetchMemory_;
+    unsigned lobPrefetchSize_;
+
+    // default for oracle_statement_backend::set_batch_errors()
+    bool useBatchErrors_;
+
+private:
+    void get_pooled_session(std::string const & serviceName,
+        std::string const & userName, std::string const & password,
+        int mode, int charset, int ncharset, unsigned sessionPoolSize);
+    void set_statement_cache_size();
 };
 
 struct oracle_backend_factory : backend_factory
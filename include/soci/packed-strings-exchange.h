@@ -0,0 +1,65 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PACKED_STRINGS_EXCHANGE_H_INCLUDED
+#define SOCI_PACKED_STRINGS_EXCHANGE_H_INCLUDED
+
+#include "soci/packed-strings.h"
+#include "soci/into-type.h"
+#include "soci/use-type.h"
+// std
+#include <string>
+#include <vector>
+
+namespace soci
+{
+
+namespace details
+{
+
+// packed_strings is always exchanged in bulk, just as std::vector<std::string>
+
+template <>
+class into_type<packed_strings> : public vector_into_type
+{
+public:
+    into_type(packed_strings & v)
+        : vector_into_type(&v, x_packedstrings) {}
+    into_type(packed_strings & v, std::vector<indicator> & ind)
+        : vector_into_type(&v, x_packedstrings, ind) {}
+};
+
+template <>
+class use_type<packed_strings> : public vector_use_type
+{
+public:
+    use_type(packed_strings & v, std::string const & name = std::string())
+        : vector_use_type(&v, x_packedstrings, name) {}
+    use_type(packed_strings const & v,
+        std::string const & name = std::string())
+        : vector_use_type(const_cast<packed_strings *>(&v),
+            x_packedstrings, name) {}
+    use_type(packed_strings & v, std::vector<indicator> const & ind,
+        std::string const & name = std::string())
+        : vector_use_type(&v, x_packedstrings, ind, name) {}
+    use_type(packed_strings const & v, std::vector<indicator> const & ind,
+        std::string const & name = std::string())
+        : vector_use_type(const_cast<packed_strings *>(&v),
+            x_packedstrings, ind, name) {}
+};
+
+template <>
+struct exchange_traits<packed_strings>
+{
+    typedef basic_type_tag type_family;
+    enum { x_type = x_packedstrings };
+};
+
+} // namespace details
+
+} // namespace soci
+
+#endif // SOCI_PACKED_STRINGS_EXCHANGE_H_INCLUDED
@@ -0,0 +1,131 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PACKED_STRINGS_H_INCLUDED
+#define SOCI_PACKED_STRINGS_H_INCLUDED
+
+#include "soci/soci-platform.h"
+#include "soci/type-wrappers.h"
+// std
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace soci
+{
+
+// Column of strings stored in a single contiguous buffer.
+//
+// This type can be used instead of std::vector<std::string> for bulk
+// operations: the characters of all the strings are appended to one buffer
+// and each element is described by its offset in it and its length, so that
+// fetching a batch of rows doesn't allocate memory for every string. Every
+// element is followed by a NUL character, so data() can be used as a C
+// string too.
+//
+// The buffer is only truncated by reset() and clear() and keeps its capacity,
+// so reusing the same object for fetching many batches of rows doesn't
+// allocate any memory once the buffer grows large enough.
+class packed_strings
+{
+public:
+    packed_strings() {}
+
+    std::size_t size() const { return offsets_.size(); }
+    bool empty() const { return offsets_.empty(); }
+
+    // Total number of characters currently stored in the buffer, including
+    // the trailing NULs.
+    std::size_t buffer_size() const { return chars_.size(); }
+
+    void reserve(std::size_t count, std::size_t chars)
+    {
+        offsets_.reserve(count);
+        lengths_.reserve(count);
+        chars_.reserve(chars);
+    }
+
+    // Change the number of elements, new elements are empty.
+    void resize(std::size_t count)
+    {
+        offsets_.resize(count, 0);
+        lengths_.resize(count, 0);
+    }
+
+    // Make all the existing elements empty and release their storage.
+    void reset()
+    {
+        chars_.clear();
+        std::fill(offsets_.begin(), offsets_.end(), 0);
+        std::fill(lengths_.begin(), lengths_.end(), 0);
+    }
+
+    void clear()
+    {
+        chars_.clear();
+        offsets_.clear();
+        lengths_.clear();
+    }
+
+    void push_back(char const * s, std::size_t len)
+    {
+        offsets_.push_back(append(s, len));
+        lengths_.push_back(len);
+    }
+
+    void push_back(std::string const & s)
+    {
+        push_back(s.data(), s.size());
+    }
+
+    // Replace the value of an existing element. Note that the storage used by
+    // the previous value is not reused until reset() is called.
+    void set(std::size_t i, char const * s, std::size_t len)
+    {
+        offsets_[i] = append(s, len);
+        lengths_[i] = len;
+    }
+
+    void set(std::size_t i, std::string const & s)
+    {
+        set(i, s.data(), s.size());
+    }
+
+    char const * data(std::size_t i) const
+    {
+        return lengths_[i] != 0 ? &chars_[offsets_[i]] : "";
+    }
+
+    std::size_t length(std::size_t i) const { return lengths_[i]; }
+
+    string_ref operator[](std::size_t i) const
+    {
+        return string_ref(data(i), lengths_[i]);
+    }
+
+    std::string str(std::size_t i) const
+    {
+        return std::string(data(i), lengths_[i]);
+    }
+
+private:
+    std::size_t append(char const * s, std::size_t len)
+    {
+        std::size_t const offset = chars_.size();
+        chars_.insert(chars_.end(), s, s + len);
+        chars_.push_back('\0');
+        return offset;
+    }
+
+    std::vector<char> chars_;
+    std::vector<std::size_t> offsets_;
+    std::vector<std::size_t> lengths_;
+};
+
+} // namespace soci
+
+#endif // SOCI_PACKED_STRINGS_H_INCLUDED
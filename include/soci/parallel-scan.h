@@ -0,0 +1,125 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PARALLEL_SCAN_H_INCLUDED
+#define SOCI_PARALLEL_SCAN_H_INCLUDED
+
+#include "soci/soci-platform.h"
+#include "soci/values.h"
+// std
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace soci
+{
+
+class connection_pool;
+
+// Interface for receiving the rows fetched by parallel_scan.
+class SOCI_DECL scan_handler
+{
+public:
+    virtual ~scan_handler() {}
+
+    // Called for each batch of rows of the given partition. This function is
+    // called from the worker threads and so may be called concurrently for
+    // different partitions. The rows may be swapped with another vector.
+    virtual void on_batch(std::size_t partition, std::vector<values> & rows) = 0;
+
+    // Called once all partitions were scanned or the scan was stopped
+    // because of an error.
+    virtual void on_finished() {}
+
+    // Called when the scan is stopped by parallel_scan::stop() or because of
+    // an error, from the thread calling stop() or the worker thread which
+    // got the error. on_batch() must not block any more after this, as the
+    // scan waits for the worker threads to terminate. This function must
+    // not call any parallel_scan functions.
+    virtual void on_stop() {}
+};
+
+// Bounded queue of batches filled by parallel_scan and consumed by another
+// thread, typically the one which started the scan. The worker threads block
+// while the queue is full, so it must be consumed until pop() returns false
+// or the scan must be stopped.
+class SOCI_DECL scan_queue : public scan_handler
+{
+public:
+    explicit scan_queue(std::size_t capacity);
+    ~scan_queue();
+
+    // Wait for the next batch and return true or return false if the scan
+    // has finished and all batches were already consumed or if it was
+    // stopped, in which case the remaining batches are discarded.
+    bool pop(std::size_t & partition, std::vector<values> & rows);
+
+    // Return the number of batches currently in the queue.
+    std::size_t size() const;
+
+    void on_batch(std::size_t partition,
+        std::vector<values> & rows) SOCI_OVERRIDE;
+    void on_finished() SOCI_OVERRIDE;
+    void on_stop() SOCI_OVERRIDE;
+
+private:
+    struct scan_queue_impl;
+    scan_queue_impl * pimpl_;
+
+    SOCI_NOT_COPYABLE(scan_queue)
+};
+
+// Run the given query for each partition of the data concurrently, using the
+// sessions leased from the pool.
+//
+// The query is executed once for each partition with the values of the
+// named parameters ":partition", from 0 to the number of partitions, and
+// ":partitions" bound to it, e.g.
+//
+//      select * from t where mod(id, :partitions) = :partition
+//
+// It's the responsibility of the query to return disjoint subsets of data
+// for different partitions.
+class SOCI_DECL parallel_scan
+{
+public:
+    parallel_scan(connection_pool & pool, std::string const & query,
+        std::size_t partitions);
+
+    // Waits for the scan termination if it's still running.
+    ~parallel_scan();
+
+    // Set the number of rows fetched at once, 1000 by default.
+    void set_batch_size(std::size_t batchSize);
+
+    // Set the number of threads used, by default equal to the number of
+    // partitions. Each thread uses one session from the pool at a time.
+    void set_threads(std::size_t threads);
+
+    // Start scanning in the background threads.
+    void start(scan_handler & handler);
+
+    // Wait until the scan terminates and throw if it failed.
+    void wait();
+
+    // Start and wait for the scan.
+    void run(scan_handler & handler);
+
+    // Stop the scan as soon as possible, i.e. after the batches being
+    // currently fetched, and call the handler on_stop() to let the worker
+    // threads waiting in on_batch() terminate.
+    void stop();
+
+private:
+    struct parallel_scan_impl;
+    parallel_scan_impl * pimpl_;
+
+    SOCI_NOT_COPYABLE(parallel_scan)
+};
+
+} // namespace soci
+
+#endif // SOCI_PARALLEL_SCAN_H_INCLUDED
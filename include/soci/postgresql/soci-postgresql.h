@@ -268,6 +268,9 @@ struct postgresql_statement_backend : details::statement_backend
     exec_fetch_result execute(int number) SOCI_OVERRIDE;
     exec_fetch_result fetch(int number) SOCI_OVERRIDE;
 
+    int start_execute(int number) SOCI_OVERRIDE;
+    bool is_result_pending() SOCI_OVERRIDE;
+
     long long get_affected_rows() SOCI_OVERRIDE;
     int get_number_of_rows() SOCI_OVERRIDE;
     std::string get_parameter_name(int index) const SOCI_OVERRIDE;
@@ -277,12 +280,22 @@ struct postgresql_statement_backend : details::statement_backend
     int prepare_for_describe() SOCI_OVERRIDE;
     void describe_column(int colNum, data_type & dtype,
         std::string & columnName) SOCI_OVERRIDE;
+    bool has_data_independent_types() const SOCI_OVERRIDE { return true; }
 
     postgresql_standard_into_type_backend * make_into_type_backend() SOCI_OVERRIDE;
     postgresql_standard_use_type_backend * make_use_type_backend() SOCI_OVERRIDE;
     postgresql_vector_into_type_backend * make_vector_into_type_backend() SOCI_OVERRIDE;
     postgresql_vector_use_type_backend * make_vector_use_type_backend() SOCI_OVERRIDE;
 
+    // account for the memory used by the current result
+    void account_for_result();
+
+    // fill the values of the parameters for the given execution of the query
+    void get_parameter_values(int row, std::vector<char *> & paramValues);
+
+    // send the query without waiting for its result
+    void send_query(std::vector<char *> & paramValues);
+
     postgresql_session_backend & session_;
 
     bool single_row_mode_;
@@ -302,6 +315,9 @@ struct postgresql_statement_backend : details::statement_backend
     bool justDescribed_; // to optimize row description with immediately
                          // following actual statement execution
 
+    bool resultPending_; // the query was sent by start_execute() but its
+                         // result wasn't retrieved yet
+
     bool hasIntoElements_;
     bool hasVectorIntoElements_;
     bool hasUseElements_;
@@ -0,0 +1,67 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_QUERY_TEXT_H_INCLUDED
+#define SOCI_QUERY_TEXT_H_INCLUDED
+
+#include "soci/soci-platform.h"
+// std
+#include <cstddef>
+#include <string>
+
+namespace soci
+{
+
+// Immutable query text with its precomputed hash.
+//
+// Copying objects of this class is cheap as all copies share the same text,
+// which allows the session to intern the texts of the queries executed
+// repeatedly and use the hash as a key for the caches or statistics.
+//
+// The copies of the same object can be used and destroyed by different
+// threads concurrently, as the text they share is immutable and its reference
+// count is updated atomically, but, just as for any other class, a single
+// object must not be modified by one thread while being used by another one.
+class SOCI_DECL query_text
+{
+public:
+    // Creates an empty query.
+    query_text();
+    explicit query_text(std::string const & text);
+
+    // Creates the query with the already computed hash, which must be the
+    // value returned by compute_hash() for this text.
+    query_text(std::string const & text, std::size_t hash);
+
+    query_text(query_text const & other);
+    query_text & operator=(query_text const & other);
+    ~query_text();
+
+    std::string const & str() const;
+    std::size_t hash() const;
+    bool empty() const { return str().empty(); }
+
+    // Returns true if both objects share the same text, which is faster than
+    // comparing the texts.
+    bool is_same(query_text const & other) const { return rep_ == other.rep_; }
+
+    bool operator==(query_text const & other) const;
+    bool operator!=(query_text const & other) const
+    {
+        return !(*this == other);
+    }
+
+    // FNV-1a hash of the text, as returned by hash().
+    static std::size_t compute_hash(std::string const & text);
+
+private:
+    struct query_text_rep;
+    query_text_rep * rep_;
+};
+
+} // namespace soci
+
+#endif // SOCI_QUERY_TEXT_H_INCLUDED
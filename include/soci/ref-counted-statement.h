@@ -91,6 +91,8 @@ public:
     template <typename T>
     void exchange(T &t) { st_.exchange(t); }
 
+    void cache_results(int timeToLive) { st_.cache_results(timeToLive); }
+
 private:
     statement st_;
 };
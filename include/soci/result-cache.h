@@ -0,0 +1,139 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_RESULT_CACHE_H_INCLUDED
+#define SOCI_RESULT_CACHE_H_INCLUDED
+
+#include "soci/soci-platform.h"
+#include "soci/soci-backend.h"
+// std
+#include <cstddef>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace soci
+{
+
+namespace details
+{
+
+// Copy of the value fetched into a single into element.
+struct cached_value
+{
+    cached_value()
+        : type_(x_integer), ind_(i_ok), int_(0), uint_(0), double_(0), tm_()
+    {}
+
+    exchange_type type_;
+    indicator ind_;
+
+    // Only the field(s) corresponding to type_ are used.
+    std::string str_;
+    long long int_;
+    unsigned long long uint_;
+    double double_;
+    std::tm tm_;
+};
+
+// Type of the marker returned by cached().
+struct cached_type
+{
+    explicit cached_type(int timeToLive) : timeToLive_(timeToLive) {}
+
+    int timeToLive_;
+};
+
+} // namespace details
+
+// Mark the query executed once as one whose result should be cached, e.g.
+//
+//      sql << "select name from person where id = :id",
+//          cached(), into(name), use(id);
+//
+// The result is stored in the cache associated with the session for the
+// time to live of the cache or, if it is specified, for the given number of
+// seconds, with 0 meaning forever.
+inline details::cached_type cached()
+{
+    return details::cached_type(-1);
+}
+
+inline details::cached_type cached(int timeToLive)
+{
+    return details::cached_type(timeToLive);
+}
+
+// Client-side cache of the results of read-mostly queries.
+//
+// When a cache is associated with the session, the results of the queries
+// executed once, i.e. using session::operator<<(), and marked with cached()
+// into single values of the basic types are stored in it, using the query
+// text and the values of all use elements as the key. Executing the same
+// query with the same parameters again then fills the into elements from the
+// cache without accessing the database at all. The other queries don't use
+// the cache.
+//
+// The cache has a fixed maximal number of entries, with the least recently
+// used ones being evicted when it is full, and, optionally, a time to live
+// for its entries. As it knows nothing about the modifications done to the
+// database, invalidate() must be called to remove the stale results.
+//
+// Just as session, this class is not thread-safe.
+class SOCI_DECL result_cache
+{
+public:
+    // Create a cache containing at most the given number of results, each of
+    // which remains valid during the given number of seconds, or forever if
+    // it is 0.
+    explicit result_cache(std::size_t maxEntries, int timeToLive = 0);
+    ~result_cache();
+
+    // Remove all the cached results.
+    void invalidate();
+
+    // Remove the results of the given query, for all parameter values.
+    //
+    // Notice that the query must be given exactly as it was executed, i.e.
+    // after applying the query transformation set for the session, if any.
+    void invalidate(std::string const & query);
+
+    std::size_t size() const;
+
+    // Statistics about the cache lookups.
+    std::size_t get_hits() const;
+    std::size_t get_misses() const;
+
+    // The functions below are used by statement_impl only.
+
+    // Find the cached result for the given key: returns false if there is
+    // none, otherwise fills the output parameters with the cached values.
+    //
+    // This doesn't update the statistics, as the found values may still turn
+    // out to be unusable, call record_lookup() to do it.
+    bool find(std::string const & key,
+        bool & gotData, std::vector<details::cached_value> & values);
+
+    // Count a cache hit, if the cached values were used, or a miss.
+    void record_lookup(bool hit);
+
+    // Store the result of the query with the given key for the given number
+    // of seconds, 0 meaning forever, or, if it is negative, for the time to
+    // live of the cache.
+    void store(std::string const & key,
+        bool gotData, std::vector<details::cached_value> const & values,
+        int timeToLive);
+
+private:
+    struct result_cache_impl;
+    result_cache_impl * pimpl_;
+
+    SOCI_NOT_COPYABLE(result_cache)
+};
+
+} // namespace soci
+
+#endif // SOCI_RESULT_CACHE_H_INCLUDED
@@ -0,0 +1,97 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_ROUTING_POOL_H_INCLUDED
+#define SOCI_ROUTING_POOL_H_INCLUDED
+
+#include "soci/soci-platform.h"
+// std
+#include <cstddef>
+
+namespace soci
+{
+
+class connection_pool;
+class session;
+
+// Router splitting reads and writes between the connection pool for the
+// primary database and the pools for its read-only replicas.
+//
+// This class is thread-safe, i.e. the pools can be selected by multiple
+// threads at the same time.
+class SOCI_DECL routing_pool
+{
+public:
+    enum replica_selection
+    {
+        round_robin,    // use all healthy replicas in turn
+        least_loaded    // use the replica with the most free sessions
+    };
+
+    // Create the router for the primary pool, which must have been already
+    // connected. The router takes ownership of it.
+    explicit routing_pool(connection_pool * primary,
+        replica_selection selection = round_robin);
+    ~routing_pool();
+
+    // Add the pool for another replica, the router takes ownership of it.
+    // This function must not be called concurrently with the others.
+    void add_replica(connection_pool * replica);
+
+    std::size_t get_replicas_count() const;
+
+    // Return the pool to lease the session from: the primary one for writes
+    // and one of the healthy replicas, if any, or the primary otherwise, for
+    // reads, e.g.
+    //
+    //      session sql(router.lease_for_read());
+    //
+    connection_pool & lease_for_write();
+    connection_pool & lease_for_read();
+
+    // Mark the replica as (un)healthy: unhealthy replicas are not used for
+    // reading until they're marked as healthy again.
+    void set_replica_healthy(std::size_t n, bool healthy);
+    bool is_replica_healthy(std::size_t n) const;
+
+    // Check the health of all replicas by executing a trivial query using a
+    // free session of each of them and trying to reconnect it if it fails.
+    // Replicas without any free sessions are busy and so keep their state.
+    void check_replicas();
+
+private:
+    struct routing_pool_impl;
+    routing_pool_impl * pimpl_;
+
+    SOCI_NOT_COPYABLE(routing_pool)
+};
+
+// Sessions for reading and writing leased from a routing_pool on demand.
+//
+// The reads are done using the primary session instead of the replica one
+// while it is in a transaction, so that they see the changes done in it.
+//
+// Just as session, this class is not thread-safe.
+class SOCI_DECL routed_session
+{
+public:
+    explicit routed_session(routing_pool & pool);
+    ~routed_session();
+
+    session & for_read();
+    session & for_write();
+
+private:
+    routing_pool & pool_;
+    session * readSession_;
+    session * writeSession_;
+
+    SOCI_NOT_COPYABLE(routed_session)
+};
+
+} // namespace soci
+
+#endif // SOCI_ROUTING_POOL_H_INCLUDED
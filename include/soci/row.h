@@ -26,7 +26,7 @@ class SOCI_DECL column_properties
     // of the getters lazy in the future
 public:
 
-    std::string get_name() const { return name_; }
+    std::string const& get_name() const { return name_; }
     data_type get_data_type() const { return dataType_; }
 
     void set_name(std::string const& name) { name_ = name; }
@@ -37,6 +37,36 @@ private:
     data_type dataType_;
 };
 
+class row;
+
+// Handle to a column of a row resolved once, by name or position, and
+// remembering both the column position and the location of its value, so
+// that reading it for each fetched row requires neither looking up the name
+// nor checking the type again.
+//
+// The accessor remains valid as long as the row is not described anew, i.e.
+// typically for the lifetime of the statement or rowset it was obtained for.
+template <typename T>
+class column_accessor
+{
+public:
+    column_accessor()
+        : row_(NULL), generation_(0), pos_(0), value_(NULL), ind_(NULL) {}
+
+    std::size_t get_position() const { return pos_; }
+
+private:
+    friend class row;
+
+    typedef typename type_conversion<T>::base_type base_type;
+
+    row const * row_;
+    std::size_t generation_;
+    std::size_t pos_;
+    base_type const * value_;
+    indicator const * ind_;
+};
+
 class SOCI_DECL row
 {
 public:
@@ -45,6 +75,9 @@ public:
 
     void uppercase_column_names(bool forceToUpper);
     void add_properties(column_properties const& cp);
+
+    // Return a new row containing copies of all the values of this one.
+    row * clone() const;
     std::size_t size() const;
     void clean_up();
 
@@ -103,6 +136,51 @@ public:
         return get<T>(pos);
     }
 
+    template <typename T>
+    column_accessor<T> get_accessor(std::size_t pos) const
+    {
+        typedef typename type_conversion<T>::base_type base_type;
+
+        column_accessor<T> col;
+        col.row_ = this;
+        col.generation_ = generation_;
+        col.pos_ = pos;
+        col.value_ = holders_.at(pos)->get_ptr<base_type>();
+        col.ind_ = indicators_[pos];
+        return col;
+    }
+
+    template <typename T>
+    column_accessor<T> get_accessor(std::string const &name) const
+    {
+        return get_accessor<T>(find_column(name));
+    }
+
+    template <typename T>
+    T get(column_accessor<T> const &col) const
+    {
+        check_accessor(col.row_, col.generation_);
+
+        T ret;
+        type_conversion<T>::from_base(*col.value_, *col.ind_, ret);
+        return ret;
+    }
+
+    template <typename T>
+    T get(column_accessor<T> const &col, T const &nullValue) const
+    {
+        check_accessor(col.row_, col.generation_);
+
+        if (i_null == *col.ind_)
+        {
+            return nullValue;
+        }
+
+        T ret;
+        type_conversion<T>::from_base(*col.value_, *col.ind_, ret);
+        return ret;
+    }
+
     template <typename T>
     row const& operator>>(T& value) const
     {
@@ -126,10 +204,25 @@ private:
 
     std::size_t find_column(std::string const& name) const;
 
+    void check_accessor(row const * owner, std::size_t generation) const
+    {
+        if (owner != this || generation != generation_)
+        {
+            throw soci_error("Column accessor is not valid for this row.");
+        }
+    }
+
     std::vector<column_properties> columns_;
     std::vector<details::holder*> holders_;
     std::vector<indicator*> indicators_;
-    std::map<std::string, std::size_t> index_;
+
+    // index of the columns by name, built only when a column is looked up by
+    // name for the first time
+    mutable std::map<std::string, std::size_t> index_;
+
+    // incremented whenever the row description is discarded, invalidating
+    // all the column accessors obtained before
+    std::size_t generation_;
 
     bool uppercaseColumnNames_;
     mutable std::size_t currentPos_;
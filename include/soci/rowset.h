@@ -114,10 +114,10 @@ public:
     typedef rowset_iterator<T> iterator;
 
     rowset_impl(details::prepare_temp_type const & prep)
-        : refs_(1), st_(new statement(prep)), define_(new T())
+        : refs_(1), st_(prep), define_()
     {
-        st_->exchange_for_rowset(into(*define_));
-        st_->execute();
+        st_.exchange_for_rowset(into(define_));
+        st_.execute();
     }
 
     void incRef()
@@ -133,10 +133,10 @@ public:
         }
     }
 
-    iterator begin() const
+    iterator begin()
     {
         // No ownership transfer occurs here
-        return iterator(*st_, *define_);
+        return iterator(st_, define_);
     }
 
     iterator end() const
@@ -148,8 +148,10 @@ private:
 
     unsigned int refs_;
 
-    const cxx_details::auto_ptr<statement> st_;
-    const cxx_details::auto_ptr<T> define_;
+    // Both objects are referenced by the iterators and so must not be moved,
+    // which is guaranteed by rowset_impl itself always being heap-allocated.
+    statement st_;
+    T define_;
     SOCI_NOT_COPYABLE(rowset_impl)
 }; // class rowset_impl
 
@@ -184,7 +186,10 @@ public:
 
     ~rowset()
     {
-        pimpl_->decRef();
+        if (pimpl_ != NULL)
+        {
+            pimpl_->decRef();
+        }
     }
 
     rowset& operator=(rowset const& rhs)
@@ -192,11 +197,37 @@ public:
         if (&rhs != this)
         {
             rhs.pimpl_->incRef();
-            pimpl_->decRef();
+            if (pimpl_ != NULL)
+            {
+                pimpl_->decRef();
+            }
+            pimpl_ = rhs.pimpl_;
+        }
+        return *this;
+    }
+
+#if defined(SOCI_HAVE_CXX_C11) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+    // The moved-from rowset can only be destroyed or assigned to.
+    rowset(rowset&& other) noexcept
+        : pimpl_(other.pimpl_)
+    {
+        other.pimpl_ = NULL;
+    }
+
+    rowset& operator=(rowset&& rhs) noexcept
+    {
+        if (&rhs != this)
+        {
+            if (pimpl_ != NULL)
+            {
+                pimpl_->decRef();
+            }
             pimpl_ = rhs.pimpl_;
+            rhs.pimpl_ = NULL;
         }
         return *this;
     }
+#endif
 
     const_iterator begin() const
     {
@@ -13,24 +13,30 @@
 #include "soci/query_transformation.h"
 #include "soci/connection-parameters.h"
 #include "soci/logger.h"
+#include "soci/query-text.h"
+#include "soci/row.h"
 
 // std
 #include <cstddef>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace soci
 {
 class values;
 class backend_factory;
+class result_cache;
 
 namespace details
 {
 
 class session_backend;
 class statement_backend;
+class statement_impl;
 class rowid_backend;
 class blob_backend;
 
@@ -57,6 +63,16 @@ public:
 
     ~session();
 
+#if defined(SOCI_HAVE_CXX_C11) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+    // Sessions can be moved, e.g. returned from functions or stored in
+    // containers, but only if there are no statements using them, as the
+    // statements refer to the session object itself, otherwise an exception
+    // is thrown. The moved-from session is closed and can only be reopened,
+    // destroyed or assigned to.
+    session(session && other);
+    session & operator=(session && other);
+#endif
+
     void open(connection_parameters const & parameters);
     void open(backend_factory const & factory, std::string const & connectString);
     void open(std::string const & backendName, std::string const & connectString);
@@ -68,6 +84,44 @@ public:
     void commit();
     void rollback();
 
+    // Return true between the calls to begin() and commit() or rollback().
+    bool is_in_transaction() const;
+
+    // Group commit mode: when enabled, i.e. if maxStatements is not 0, a
+    // transaction is started automatically before executing a statement
+    // without into elements, i.e. modifying the data, outside of an explicit
+    // transaction and committed after executing the given number of such
+    // statements in it or, if maxDelay is not 0, once the statement executed
+    // at least maxDelay milliseconds after its start completes. If a
+    // statement fails, the whole batch is rolled back, unless undoFailedOnly
+    // is true and the backend supports savepoints: in this case a savepoint
+    // is created before each statement, at the cost of extra round trips to
+    // the server, and only the changes done by the failed one are undone.
+    void set_group_commit(std::size_t maxStatements, unsigned maxDelay = 0,
+        bool undoFailedOnly = false);
+
+    // Commit the statements executed since the last group commit now.
+    void flush_group_commit();
+
+    // Return the number of statements executed since the last group commit.
+    std::size_t get_group_commit_pending() const;
+
+    // Used by statement_impl to implement group commit.
+    void group_commit_pre_execute();
+    void group_commit_post_execute(bool succeeded);
+
+    // Used by statement_impl to allow reconnect() to prepare all the
+    // existing statements again using the new connection.
+    void register_statement(details::statement_impl * st);
+    void unregister_statement(details::statement_impl * st);
+
+    // Savepoints allow to undo only the changes done after creating them
+    // inside the current transaction. They're used by nested transaction
+    // objects but can also be used directly.
+    void savepoint(std::string const & name);
+    void release_savepoint(std::string const & name);
+    void rollback_to_savepoint(std::string const & name);
+
     // once and prepare are for syntax sugar only
     details::once_type once;
     details::prepare_type prepare;
@@ -79,6 +133,26 @@ public:
     std::ostringstream & get_query_stream();
     std::string get_query() const;
 
+    // Return the shared query text object for the given query: the session
+    // keeps the texts of the recently prepared queries, so that preparing
+    // the same query again doesn't copy its text.
+    query_text intern_query(std::string const & query);
+
+    // Return the description of the result columns of the given query
+    // remembered by set_column_descriptions() or NULL if there is none. The
+    // statements use this to avoid describing the same query again, e.g. when
+    // iterating over rowset<row> for it repeatedly, if the backend column
+    // types don't depend on the data. The descriptions are discarded when a
+    // CREATE, ALTER, DROP or RENAME statement is executed or when executing
+    // any statement fails, call clear_column_descriptions() after changing the
+    // schema otherwise, e.g. using another connection.
+    std::vector<column_properties> const *
+        get_column_descriptions(query_text const & query);
+    std::vector<column_properties> const & set_column_descriptions(
+        query_text const & query,
+        std::vector<column_properties> const & columns);
+    void clear_column_descriptions();
+
     template <typename T>
     void set_query_transformation(T callback)
     {
@@ -104,6 +178,29 @@ public:
     void log_query(std::string const & query);
     std::string get_last_query() const;
 
+    // Set the cache used for the results of the queries marked with cached(),
+    // see result_cache for more details. The cache is not owned by the session
+    // and must remain alive while it is used. Pass NULL to stop caching.
+    void set_result_cache(result_cache * cache);
+    result_cache * get_result_cache() const;
+
+    // Limit the memory used by the backend for buffering the rows fetched by
+    // any single statement and by all statements of this session together,
+    // 0 means no limit. Fetching the rows throws memory_limit_error if it
+    // would exceed either limit. Not all backends buffer the rows, e.g. those
+    // fetching them directly into the bulk into elements don't use any memory
+    // beyond them, so this is only useful with some of them. Notice that the
+    // PostgreSQL and MySQL client libraries receive the entire result before
+    // it can be checked, so with these backends the limit only ensures that
+    // the result is freed immediately and doesn't prevent the memory from
+    // being allocated, unless the PostgreSQL single-row mode is used.
+    void set_fetch_memory_limit(std::size_t maxStatementBytes,
+        std::size_t maxSessionBytes = 0);
+
+    // Return the memory currently used for the fetched rows by all
+    // statements of this session. It is only tracked while a limit is set.
+    std::size_t get_fetch_memory_used() const;
+
     void set_got_data(bool gotData);
     bool got_data() const;
 
@@ -190,6 +287,23 @@ public:
 private:
     SOCI_NOT_COPYABLE(session)
 
+#if defined(SOCI_HAVE_CXX_C11) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+    // take over the state of the other session and leave it closed
+    void move_from(session & other);
+#endif
+
+    // create the savepoint to return to if the next statement executed in
+    // group commit mode fails, releasing the previous one
+    void group_commit_savepoint();
+
+    // release the backends of the statements registered with this session
+    // before closing it and create them again after reconnecting
+    void release_statements();
+    void restore_statements();
+
+    // used to generate unique names of the savepoints for nested transactions
+    friend class transaction;
+
     std::ostringstream query_stream_;
     details::query_transformation_function* query_transformation_;
 
@@ -201,8 +315,45 @@ private:
 
     details::session_backend * backEnd_;
 
+    result_cache * resultCache_;
+
     bool gotData_;
 
+    bool isInTransaction_;
+    std::size_t nestedTransactions_;
+
+    std::size_t groupCommitMaxStatements_;
+    unsigned groupCommitMaxDelay_;
+    std::size_t groupCommitPending_;
+    bool isInGroupCommit_;
+    unsigned long long groupCommitStart_;
+    bool groupCommitUndoFailedOnly_;
+    bool groupCommitSavepointSet_;
+
+    std::size_t fetchMemoryStatementLimit_;
+    std::size_t fetchMemorySessionLimit_;
+
+    // interned query texts indexed by their hashes
+    std::map<std::size_t, query_text> internedQueries_;
+
+    // descriptions of the result columns of the recently described queries
+    // indexed by the query hashes
+    struct column_descriptions
+    {
+        query_text query_;
+
+        // the column names are stored already converted to upper case if
+        // this flag is set, to avoid doing it every time they're used
+        bool uppercaseColumnNames_;
+
+        std::vector<column_properties> columns_;
+    };
+    typedef std::map<std::size_t, column_descriptions> column_descriptions_map;
+    column_descriptions_map columnDescriptions_;
+
+    // all the currently existing statements using this session
+    std::vector<details::statement_impl *> statements_;
+
     bool isFromPool_;
     std::size_t poolPosition_;
     connection_pool * pool_;
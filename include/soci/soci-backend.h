@@ -51,7 +51,11 @@ enum exchange_type
     x_blob,
 
     x_xmltype,
-    x_longstring
+    x_longstring,
+    x_stringref,
+    x_packedstrings,
+    x_timestamp,
+    x_decimal
 };
 
 // type of statement (used for optimizing statement preparation)
@@ -167,13 +171,109 @@ private:
     SOCI_NOT_COPYABLE(vector_use_type_backend)
 };
 
+// accounting of the memory used by the backends for buffering the fetched
+// rows, shared by all statements of the same session
+
+class fetch_memory_tracker
+{
+public:
+    fetch_memory_tracker() : statementLimit_(0), sessionLimit_(0), used_(0) {}
+
+    // 0 means that there is no limit
+    void set_limits(std::size_t statementLimit, std::size_t sessionLimit)
+    {
+        statementLimit_ = statementLimit;
+        sessionLimit_ = sessionLimit;
+    }
+
+    // the memory is only accounted for if any limit is set
+    bool is_enabled() const { return statementLimit_ != 0 || sessionLimit_ != 0; }
+
+    std::size_t get_used() const { return used_; }
+
+    // Account for the additional bytes buffered by the statement currently
+    // using statementBytes, which is updated, or throw if this would exceed
+    // any of the limits.
+    void allocate(std::size_t & statementBytes, std::size_t bytes)
+    {
+        if (statementLimit_ != 0 && statementBytes + bytes > statementLimit_)
+        {
+            throw_limit_exceeded("statement", statementBytes + bytes,
+                statementLimit_);
+        }
+
+        if (sessionLimit_ != 0 && used_ + bytes > sessionLimit_)
+        {
+            throw_limit_exceeded("session", used_ + bytes, sessionLimit_);
+        }
+
+        statementBytes += bytes;
+        used_ += bytes;
+    }
+
+    void release(std::size_t & statementBytes)
+    {
+        used_ -= statementBytes;
+        statementBytes = 0;
+    }
+
+private:
+    static void throw_limit_exceeded(char const * what, std::size_t needed,
+        std::size_t limit)
+    {
+        std::ostringstream ss;
+        ss << "Fetching the rows requires buffering " << needed
+           << " bytes, exceeding the limit of " << limit << " bytes per "
+           << what << ".";
+        throw memory_limit_error(ss.str());
+    }
+
+    std::size_t statementLimit_;
+    std::size_t sessionLimit_;
+    std::size_t used_;
+};
+
 // polymorphic statement backend
 
 class statement_backend
 {
 public:
-    statement_backend() {}
-    virtual ~statement_backend() {}
+    statement_backend() : memoryTracker_(NULL), bufferedBytes_(0) {}
+    virtual ~statement_backend() { release_buffered_bytes(); }
+
+    // Used by the core to associate the statement with its session tracker.
+    void set_memory_tracker(fetch_memory_tracker * tracker)
+    {
+        memoryTracker_ = tracker;
+    }
+
+    // Return false if there is no need to compute the memory used by the
+    // fetched rows, as it is not limited, which can be relatively expensive.
+    bool is_fetch_memory_limited() const
+    {
+        return memoryTracker_ != NULL && memoryTracker_->is_enabled();
+    }
+
+    // The backends buffering the fetched rows should call this function
+    // before allocating memory for them, to check that the configured limits
+    // are not exceeded, and release_buffered_bytes() when they free it.
+    void add_buffered_bytes(std::size_t bytes)
+    {
+        if (is_fetch_memory_limited())
+        {
+            memoryTracker_->allocate(bufferedBytes_, bytes);
+        }
+    }
+
+    void release_buffered_bytes()
+    {
+        if (memoryTracker_ != NULL)
+        {
+            memoryTracker_->release(bufferedBytes_);
+        }
+    }
+
+    std::size_t get_buffered_bytes() const { return bufferedBytes_; }
 
     virtual void alloc() = 0;
     virtual void clean_up() = 0;
@@ -189,6 +289,15 @@ public:
     virtual exec_fetch_result execute(int number) = 0;
     virtual exec_fetch_result fetch(int number) = 0;
 
+    // Non-blocking execution support: the backends able to send the
+    // statement to the server without waiting for its result override
+    // start_execute() to do it and return the socket which becomes readable
+    // when the result arrives, while is_result_pending() returns true as long
+    // as the following execute() or fetch() would still have to wait for it.
+    // By default -1 is returned and execute() waits for the result itself.
+    virtual int start_execute(int /* number */) { return -1; }
+    virtual bool is_result_pending() { return false; }
+
     virtual long long get_affected_rows() = 0;
     virtual int get_number_of_rows() = 0;
 
@@ -200,12 +309,20 @@ public:
     virtual void describe_column(int colNum, data_type& dtype,
         std::string& column_name) = 0;
 
+    // Return true if the column types returned by describe_column() depend
+    // only on the query and not on the data it returns, i.e. if the result of
+    // describing a prepared statement can be reused later.
+    virtual bool has_data_independent_types() const { return false; }
+
     virtual standard_into_type_backend* make_into_type_backend() = 0;
     virtual standard_use_type_backend* make_use_type_backend() = 0;
     virtual vector_into_type_backend* make_vector_into_type_backend() = 0;
     virtual vector_use_type_backend* make_vector_use_type_backend() = 0;
 
 private:
+    fetch_memory_tracker * memoryTracker_;
+    std::size_t bufferedBytes_;
+
     SOCI_NOT_COPYABLE(statement_backend)
 };
 
@@ -441,6 +558,23 @@ public:
         return "coalesce";
     }
 
+    // Savepoints are used for nested transactions. Standard SQL syntax is
+    // used by default, backends not supporting some of these statements
+    // return an empty string: this is allowed only for release, which is
+    // simply not done then.
+    virtual std::string set_savepoint(const std::string & name)
+    {
+        return "savepoint " + name;
+    }
+    virtual std::string release_savepoint(const std::string & name)
+    {
+        return "release savepoint " + name;
+    }
+    virtual std::string rollback_to_savepoint(const std::string & name)
+    {
+        return "rollback to savepoint " + name;
+    }
+
     virtual std::string get_dummy_from_table() const = 0;
 
     void set_failover_callback(failover_callback & callback, session & sql)
@@ -458,6 +592,9 @@ public:
     failover_callback * failoverCallback_;
     session * session_;
 
+    // memory used by all statements of this session for the fetched rows
+    fetch_memory_tracker memoryTracker_;
+
 private:
     SOCI_NOT_COPYABLE(session_backend)
 };
@@ -134,6 +134,22 @@ namespace cxx_details
 
 #define SOCI_UNUSED(x) (void)x;
 
+// Coroutines are only available in C++20 and only if the standard library
+// provides the <coroutine> header too. Note that g++ keeps defining the
+// feature test macro when -std=c++20 is overridden by an older standard.
+#if defined(_MSVC_LANG)
+    #define SOCI_CPLUSPLUS _MSVC_LANG
+#else
+    #define SOCI_CPLUSPLUS __cplusplus
+#endif
+
+#if defined(__cpp_impl_coroutine) && SOCI_CPLUSPLUS >= 202002L && \
+    defined(__has_include)
+    #if __has_include(<coroutine>)
+        #define SOCI_HAVE_COROUTINES
+    #endif
+#endif
+
 #if defined(SOCI_HAVE_CXX_C11) || (defined(_MSC_VER) && _MSC_VER >= 1900)
     #define SOCI_NOEXCEPT_FALSE noexcept(false)
 #else
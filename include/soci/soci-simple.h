@@ -87,6 +87,17 @@ SOCI_DECL long long    soci_get_into_long_long_v(statement_handle st, int positi
 SOCI_DECL double       soci_get_into_double_v   (statement_handle st, int position, int index);
 SOCI_DECL char const * soci_get_into_date_v     (statement_handle st, int position, int index);
 
+// positional read of whole vectors
+// (the functions fill at most size elements of the given array and return
+// the number of filled elements or -1 on error, the strings and buffers
+// remain valid until the next fetch or resize of the into elements)
+SOCI_DECL int soci_get_into_states_v (statement_handle st, int position, int * states, int size);
+SOCI_DECL int soci_get_into_strings_v(statement_handle st, int position, char const ** vals, int size);
+
+SOCI_DECL int const *       soci_get_into_int_buffer_v      (statement_handle st, int position);
+SOCI_DECL long long const * soci_get_into_long_long_buffer_v(statement_handle st, int position);
+SOCI_DECL double const *    soci_get_into_double_buffer_v   (statement_handle st, int position);
+
 
 // named bind of use elements
 SOCI_DECL void soci_use_string   (statement_handle st, char const * name);
@@ -131,6 +142,20 @@ SOCI_DECL void soci_set_use_double_v(statement_handle st,
 SOCI_DECL void soci_set_use_date_v(statement_handle st,
     char const * name, int index, char const * val);
 
+// named write of whole use vectors
+// (the functions set at most size elements and return the number of set
+// elements or -1 on error, null string pointers set the element to null)
+SOCI_DECL int soci_set_use_states_v(statement_handle st,
+    char const * name, int const * states, int size);
+SOCI_DECL int soci_set_use_strings_v(statement_handle st,
+    char const * name, char const * const * vals, int size);
+SOCI_DECL int soci_set_use_ints_v(statement_handle st,
+    char const * name, int const * vals, int size);
+SOCI_DECL int soci_set_use_long_longs_v(statement_handle st,
+    char const * name, long long const * vals, int size);
+SOCI_DECL int soci_set_use_doubles_v(statement_handle st,
+    char const * name, double const * vals, int size);
+
 
 // named read of use elements (for modifiable use values)
 SOCI_DECL int          soci_get_use_state    (statement_handle st, char const * name);
@@ -17,13 +17,20 @@
 #include "soci/connection-pool.h"
 #include "soci/error.h"
 #include "soci/exchange-traits.h"
+#include "soci/generator.h"
 #include "soci/into.h"
 #include "soci/into-type.h"
 #include "soci/once-temp-type.h"
+#include "soci/packed-strings.h"
+#include "soci/packed-strings-exchange.h"
+#include "soci/parallel-scan.h"
 #include "soci/prepare-temp-type.h"
 #include "soci/procedure.h"
+#include "soci/query-text.h"
 #include "soci/ref-counted-prepare-info.h"
 #include "soci/ref-counted-statement.h"
+#include "soci/result-cache.h"
+#include "soci/routing-pool.h"
 #include "soci/row.h"
 #include "soci/row-exchange.h"
 #include "soci/rowid.h"
@@ -32,6 +39,7 @@
 #include "soci/session.h"
 #include "soci/soci-backend.h"
 #include "soci/statement.h"
+#include "soci/std-chrono.h"
 #include "soci/transaction.h"
 #include "soci/type-conversion.h"
 #include "soci/type-conversion-traits.h"
@@ -243,6 +243,7 @@ struct sqlite3_statement_backend : details::statement_backend
 private:
     exec_fetch_result load_rowset(int totalRows);
     exec_fetch_result load_one();
+    void account_for_row(int row, int numCols);
     exec_fetch_result bind_and_execute(int number);
 };
 
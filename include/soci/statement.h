@@ -12,6 +12,7 @@
 #include "soci/into-type.h"
 #include "soci/into.h"
 #include "soci/noreturn.h"
+#include "soci/query-text.h"
 #include "soci/use-type.h"
 #include "soci/use.h"
 #include "soci/soci-backend.h"
@@ -26,6 +27,7 @@ namespace soci
 
 class session;
 class values;
+class result_cache;
 
 namespace details
 {
@@ -33,6 +35,7 @@ namespace details
 class into_type_base;
 class use_type_base;
 class prepare_temp_type;
+class values_batch;
 
 class SOCI_DECL statement_impl
 {
@@ -43,6 +46,7 @@ public:
 
     void alloc();
     void bind(values & v);
+    void bind(values_batch & batch);
 
     void exchange(into_type_ptr const & i) { intos_.exchange(i); }
     template <typename T, typename Indicator>
@@ -64,9 +68,22 @@ public:
     void undefine_and_bind();
     bool execute(bool withDataExchange = false);
     long long get_affected_rows();
+
+    // Send the statement to the server without waiting for its result, if
+    // the backend supports it: the socket to wait on is returned in this case
+    // and execute() or fetch() only block while is_result_pending() returns
+    // true. If -1 is returned, execute() just waits for the result instead.
+    int start_execute();
+    bool is_result_pending();
     bool fetch();
     void describe();
     void set_row(row * r);
+    void set_values_batch(values_batch * batch);
+
+    // used by cached(): store the results in the session result cache for
+    // the given number of seconds, see result_cache::store()
+    void cache_results(int timeToLive);
+
     void exchange_for_rowset(into_type_ptr const & i) { exchange_for_rowset_(i); }
     template<typename T, typename Indicator>
     void exchange_for_rowset(into_container<T, Indicator> const &ic)
@@ -76,6 +93,9 @@ public:
     // (downcast it to expected back-end statement class)
     statement_backend * get_backend() { return backEnd_; }
 
+    // the text of the prepared query, e.g. for use as a cache key
+    query_text const & get_query_text() const { return query_; }
+
     standard_into_type_backend * make_into_type_backend();
     standard_use_type_backend * make_use_type_backend();
     vector_into_type_backend * make_vector_into_type_backend();
@@ -84,6 +104,12 @@ public:
     void inc_ref();
     void dec_ref();
 
+    // used by session::reconnect(): release all the backend objects before
+    // the old session backend is destroyed and create them again, preparing
+    // the statement and binding all its elements, for the new one
+    void release_backend();
+    void restore_backend();
+
     session & session_;
 
     std::string rewrite_for_procedure_call(std::string const & query);
@@ -91,7 +117,6 @@ public:
 protected:
     into_type_vector intos_;
     use_type_vector uses_;
-    std::vector<indicator *> indicators_;
 
 private:
     // Call this method from a catch clause (only!) to rethrow the exception
@@ -103,9 +128,18 @@ private:
     int refCount_;
 
     row * row_;
+    values_batch * batch_;
     std::size_t fetchSize_;
     std::size_t initialFetchSize_;
-    std::string query_;
+    query_text query_;
+    bool oneTimeQuery_;
+
+    // set by cache_results(), the results are not cached by default
+    bool cacheResults_;
+    int cacheTimeToLive_;
+
+    // set by start_execute() once the use elements were prepared
+    bool executeStarted_;
 
     into_type_vector intosForRow_;
     int definePositionForRow_;
@@ -147,8 +181,23 @@ private:
     template<data_type>
     void bind_into();
 
+    void bind_into_batch(data_type dtype, std::string const & name);
+    bool has_placeholder(std::string const & name) const;
+
+    // only the statements without into elements, i.e. modifying the data,
+    // are part of the batches committed together in group commit mode
+    bool uses_group_commit() const;
+
     bool alreadyDescribed_;
 
+    // description of the result set columns used when it can't be remembered
+    // by the session because the backend column types depend on the data,
+    // kept here only to avoid reallocating it every time
+    std::vector<column_properties> columnsDescription_;
+
+    // true if the query may change the schema, see is_schema_change()
+    bool schemaChange_;
+
     std::size_t intos_size();
     std::size_t uses_size();
     void pre_exec(int num);
@@ -158,6 +207,18 @@ private:
     void post_use(bool gotData);
     bool resize_intos(std::size_t upperBound = 0);
     void truncate_intos();
+    void resize_intos_for_row(std::size_t sz);
+
+    // Return the cache to use for the results of this execution of the
+    // statement, filling the key identifying them, or NULL if they can't be
+    // cached.
+    result_cache * get_result_cache(std::string & key);
+    bool load_from_cache(result_cache & cache, std::string const & key,
+        bool & gotData);
+    bool load_cached_values(result_cache & cache, std::string const & key,
+        bool & gotData);
+    void store_in_cache(result_cache & cache, std::string const & key,
+        bool gotData);
 
     soci::details::statement_backend * backEnd_;
 
@@ -175,11 +236,17 @@ public:
         : impl_(new details::statement_impl(s)), gotData_(false) {}
     statement(details::prepare_temp_type const & prep)
         : impl_(new details::statement_impl(prep)), gotData_(false) {}
-    ~statement() { impl_->dec_ref(); }
+    ~statement()
+    {
+        if (impl_ != NULL)
+        {
+            impl_->dec_ref();
+        }
+    }
 
     // copy is supported for this handle class
     statement(statement const & other)
-        : impl_(other.impl_)
+        : impl_(other.impl_), gotData_(other.gotData_)
     {
         impl_->inc_ref();
     }
@@ -187,11 +254,40 @@ public:
     void operator=(statement const & other)
     {
         other.impl_->inc_ref();
-        impl_->dec_ref();
+        if (impl_ != NULL)
+        {
+            impl_->dec_ref();
+        }
         impl_ = other.impl_;
         gotData_ = other.gotData_;
     }
 
+#if defined(SOCI_HAVE_CXX_C11) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+    // moving doesn't change the reference count, the moved-from statement
+    // can only be destroyed or assigned to
+    statement(statement && other) noexcept
+        : impl_(other.impl_), gotData_(other.gotData_)
+    {
+        other.impl_ = NULL;
+    }
+
+    statement & operator=(statement && other) noexcept
+    {
+        if (&other != this)
+        {
+            if (impl_ != NULL)
+            {
+                impl_->dec_ref();
+            }
+            impl_ = other.impl_;
+            gotData_ = other.gotData_;
+            other.impl_ = NULL;
+        }
+
+        return *this;
+    }
+#endif
+
     void alloc()                         { impl_->alloc();    }
     void bind(values & v)                { impl_->bind(v);    }
     void exchange(details::into_type_ptr const & i) { impl_->exchange(i); }
@@ -222,6 +318,9 @@ public:
         return impl_->get_affected_rows();
     }
 
+    int start_execute() { return impl_->start_execute(); }
+    bool is_result_pending() { return impl_->is_result_pending(); }
+
     bool fetch()
     {
         gotData_ = impl_->fetch();
@@ -232,6 +331,7 @@ public:
 
     void describe()       { impl_->describe(); }
     void set_row(row * r) { impl_->set_row(r); }
+    void cache_results(int timeToLive) { impl_->cache_results(timeToLive); }
 
     template <typename T, typename Indicator>
     void exchange_for_rowset(details::into_container<T, Indicator> const & ic)
@@ -251,6 +351,13 @@ public:
         return impl_->get_backend();
     }
 
+    // Return the text of the prepared query, which can be used as a key for
+    // the statistics or caches as it can be compared and hashed cheaply.
+    query_text const & get_query_text() const
+    {
+        return impl_->get_query_text();
+    }
+
     details::standard_into_type_backend * make_into_type_backend()
     {
         return impl_->make_into_type_backend();
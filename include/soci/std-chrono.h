@@ -0,0 +1,57 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_STD_CHRONO_H_INCLUDED
+#define SOCI_STD_CHRONO_H_INCLUDED
+
+#include "soci/soci-platform.h"
+
+#if defined(SOCI_HAVE_CXX_C11) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+
+#include "soci/error.h"
+#include "soci/type-conversion-traits.h"
+#include "soci/type-wrappers.h"
+// std
+#include <chrono>
+
+namespace soci
+{
+
+// std::chrono::system_clock::time_point is exchanged as timestamp, i.e. with
+// microsecond precision.
+template<>
+struct type_conversion<std::chrono::system_clock::time_point>
+{
+    typedef timestamp base_type;
+
+    static void from_base(base_type const & in, indicator ind,
+        std::chrono::system_clock::time_point & out)
+    {
+        if (ind == i_null)
+        {
+            throw soci_error("Null value not allowed for this type");
+        }
+
+        out = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::microseconds(in.microseconds)));
+    }
+
+    static void to_base(std::chrono::system_clock::time_point const & in,
+        base_type & out, indicator & ind)
+    {
+        out.microseconds =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                in.time_since_epoch()).count();
+        ind = i_ok;
+    }
+};
+
+} // namespace soci
+
+#endif // C++11
+
+#endif // SOCI_STD_CHRONO_H_INCLUDED
@@ -10,10 +10,16 @@
 
 #include "soci/soci-platform.h"
 #include "soci/session.h"
+// std
+#include <string>
 
 namespace soci
 {
 
+// Transaction objects can be nested: if the session is already in a
+// transaction when this object is created, a savepoint is used instead of
+// starting a new transaction, so that rolling back only undoes the changes
+// done since then while committing keeps them as part of the outer one.
 class SOCI_DECL transaction
 {
 public:
@@ -24,10 +30,17 @@ public:
     void commit();
     void rollback();
 
+    bool is_nested() const { return savepoint_.empty() == false; }
+
 private:
+    void handle();
+
     bool handled_;
     session& sql_;
 
+    // name of the savepoint for the nested transactions, empty otherwise
+    std::string savepoint_;
+
     SOCI_NOT_COPYABLE(transaction)
 };
 
@@ -29,6 +29,9 @@ public:
     holder() {}
     virtual ~holder() {}
 
+    // Return a new holder with a copy of the held value.
+    virtual holder * clone() const = 0;
+
     template<typename T>
     T get()
     {
@@ -43,6 +46,22 @@ public:
         }
     }
 
+    // Return the address of the held value, checking its type only once, so
+    // that it can be accessed directly afterwards.
+    template<typename T>
+    T * get_ptr()
+    {
+        type_holder<T>* p = dynamic_cast<type_holder<T> *>(this);
+        if (p)
+        {
+            return p->ptr();
+        }
+        else
+        {
+            throw std::bad_cast();
+        }
+    }
+
 private:
 
     template<typename T>
@@ -56,9 +75,25 @@ public:
     type_holder(T * t) : t_(t) {}
     ~type_holder() SOCI_OVERRIDE { delete t_; }
 
+    holder * clone() const SOCI_OVERRIDE
+    {
+        T * const t = new T(*t_);
+        try
+        {
+            return new type_holder<T>(t);
+        }
+        catch (...)
+        {
+            delete t;
+            throw;
+        }
+    }
+
     template<typename TypeValue>
     TypeValue value() const { return *t_; }
 
+    T * ptr() const { return t_; }
+
 private:
     T * t_;
 };
@@ -8,6 +8,10 @@
 #ifndef SOCI_TYPE_WRAPPERS_H_INCLUDED
 #define SOCI_TYPE_WRAPPERS_H_INCLUDED
 
+#include <cstddef>
+#include <cstring>
+#include <string>
+
 namespace soci
 {
 
@@ -28,6 +32,61 @@ struct long_string
     std::string value;
 };
 
+// Non-owning reference to a string, avoiding copying the string data.
+//
+// When used with 'into' elements, it points to the data stored by the
+// backend, which remains valid only until the next fetch. When used with
+// 'use' elements, the referenced characters are passed to the backend
+// without being copied into a std::string first.
+//
+// Only single (i.e. not vector) elements of this type are supported.
+struct string_ref
+{
+    string_ref() : data(NULL), length(0) {}
+    explicit string_ref(char const * s) : data(s), length(std::strlen(s)) {}
+    string_ref(char const * s, std::size_t len) : data(s), length(len) {}
+    explicit string_ref(std::string const & s)
+        : data(s.c_str()), length(s.size()) {}
+
+    std::string to_string() const
+    {
+        return length != 0 ? std::string(data, length) : std::string();
+    }
+
+    char const * data;
+    std::size_t length;
+};
+
+// Point in time with microsecond precision, stored as the number of
+// microseconds since the Unix epoch, 1970-01-01 00:00:00 UTC.
+//
+// Unlike std::tm, it preserves fractional seconds and backends convert it
+// directly from and to their native representation of date/time values
+// without normalizing it with the C library calendar functions. Values
+// without time zone are interpreted as being in UTC.
+struct timestamp
+{
+    timestamp() : microseconds(0) {}
+    explicit timestamp(long long us) : microseconds(us) {}
+
+    long long microseconds;
+};
+
+// Fixed-point decimal number equal to value * 10^-scale, e.g. 12.50 is
+// represented as value 1250 with scale 2.
+//
+// It is used for NUMERIC and DECIMAL columns to exchange their values exactly,
+// without rounding them to the closest double. The scale must be between 0
+// and 18 and the values are limited by the range of 64 bit integers.
+struct decimal
+{
+    decimal() : value(0), scale(0) {}
+    decimal(long long v, int s) : value(v), scale(s) {}
+
+    long long value;
+    int scale;
+};
+
 } // namespace soci
 
 #endif // SOCI_TYPE_WRAPPERS_H_INCLUDED
@@ -38,6 +38,15 @@ public:
     virtual void clean_up() = 0;
 
     virtual std::size_t size() const = 0;  // returns the number of elements
+
+    // used by the result cache: append the value to the key identifying the
+    // query results, returning false if it can't be used in the key
+    virtual bool append_cache_key(std::string & /* key */) const
+    { return false; }
+
+    // used when the session reconnects, see into_type_base
+    virtual void release_backend() {}
+    virtual void rebind(statement_impl & /* st */, int & /* position */) {}
 };
 
 typedef type_ptr<use_type_base> use_type_ptr;
@@ -77,6 +86,10 @@ public:
     void bind(statement_impl & st, int & position) SOCI_OVERRIDE;
     std::string get_name() const SOCI_OVERRIDE { return name_; }
     void dump_value(std::ostream& os) const SOCI_OVERRIDE;
+    bool append_cache_key(std::string & key) const SOCI_OVERRIDE;
+    void release_backend() SOCI_OVERRIDE;
+    void rebind(statement_impl & st, int & position) SOCI_OVERRIDE
+    { bind(st, position); }
     virtual void * get_data() { return data_; }
 
     // conversion hook (from arbitrary user type to base type)
@@ -154,6 +167,10 @@ public:
 
     ~vector_use_type() SOCI_OVERRIDE;
 
+    void release_backend() SOCI_OVERRIDE;
+    void rebind(statement_impl & st, int & position) SOCI_OVERRIDE
+    { bind(st, position); }
+
 private:
     void bind(statement_impl& st, int & position) SOCI_OVERRIDE;
     std::string get_name() const SOCI_OVERRIDE { return name_; }
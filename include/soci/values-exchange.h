@@ -50,6 +50,7 @@ public:
     {
         v_.uppercase_column_names(st.session_.get_uppercase_column_names());
 
+        v_.reset_set_counter();
         convert_to_base();
         st.bind(v_);
     }
@@ -88,7 +89,11 @@ public:
         convert_from_base();
     }
 
-    void pre_use() SOCI_OVERRIDE {convert_to_base();}
+    void pre_use() SOCI_OVERRIDE
+    {
+        v_.reset_set_counter();
+        convert_to_base();
+    }
     void clean_up() SOCI_OVERRIDE {v_.clean_up();}
     std::size_t size() const SOCI_OVERRIDE { return 1; }
 
@@ -104,12 +109,162 @@ private:
     SOCI_NOT_COPYABLE(use_type)
 };
 
-// this is not supposed to be used - no support for bulk ORM
+// Bulk use of values: the values set in all elements, which must have the
+// same number and types of values, are copied into the columns of a
+// values_batch bound to the statement using vector use elements.
 template <>
-class use_type<std::vector<values> >
+class use_type<std::vector<values> > : public use_type_base
 {
+public:
+    use_type(std::vector<values> & v,
+        std::string const & /*name*/ = std::string())
+        : v_(v), end_(NULL)
+    {}
+
+    use_type(std::vector<values> & v, std::size_t /*begin*/, std::size_t * end,
+        std::string const & /*name*/ = std::string())
+        : v_(v), end_(end)
+    {}
+
+    // we ignore the possibility to have the whole values as NULL
+    use_type(std::vector<values> & v, std::vector<indicator> const & /*ind*/,
+        std::string const & /*name*/ = std::string())
+        : v_(v), end_(NULL)
+    {}
+
+    use_type(std::vector<values> & v, std::vector<indicator> const & /*ind*/,
+        std::size_t /*begin*/, std::size_t * end,
+        std::string const & /*name*/ = std::string())
+        : v_(v), end_(end)
+    {}
+
+    void bind(details::statement_impl & st, int & /*position*/) SOCI_OVERRIDE
+    {
+        if (end_ != NULL)
+        {
+            throw soci_error("Vector ranges are not supported with values.");
+        }
+
+        pre_use();
+        st.bind(batch_);
+    }
+
+    std::string get_name() const SOCI_OVERRIDE
+    {
+        std::ostringstream oss;
+
+        oss << "(";
+
+        std::size_t const num_columns = batch_.get_number_of_columns();
+        for (std::size_t n = 0; n < num_columns; ++n)
+        {
+            if (n != 0)
+                oss << ", ";
+
+            oss << batch_.get_name(n);
+        }
+
+        oss << ")";
+
+        return oss.str();
+    }
+
+    void dump_value(std::ostream& os) const SOCI_OVERRIDE
+    {
+        os << "<vector>";
+    }
+
+    void pre_exec(int /* num */) SOCI_OVERRIDE {}
+
+    void pre_use() SOCI_OVERRIDE
+    {
+        std::size_t const sz = v_.size();
+        for (std::size_t i = 0; i != sz; ++i)
+        {
+            v_[i].reset_set_counter();
+        }
+
+        convert_to_base();
+
+        gather();
+    }
+
+    void post_use(bool /*gotData*/) SOCI_OVERRIDE {}
+
+    void clean_up() SOCI_OVERRIDE
+    {
+        std::size_t const sz = v_.size();
+        for (std::size_t i = 0; i != sz; ++i)
+        {
+            v_[i].clean_up();
+        }
+    }
+
+    std::size_t size() const SOCI_OVERRIDE { return v_.size(); }
+
+    // this is used only to re-dispatch to derived class
+    // (the derived class might be generated automatically by
+    // user conversions)
+    virtual void convert_to_base() {}
+
 private:
-    use_type();
+    void gather()
+    {
+        std::size_t const rows = v_.size();
+        if (rows == 0)
+        {
+            // this will be reported as an error by the statement
+            return;
+        }
+
+        std::size_t const columns = v_[0].uses_.size();
+        if (batch_.get_number_of_columns() == 0)
+        {
+            for (std::size_t c = 0; c != columns; ++c)
+            {
+                batch_.add_column(v_[0].columnFactories_[c], v_[0].names_[c]);
+            }
+        }
+        else if (batch_.get_number_of_columns() != columns)
+        {
+            throw soci_error("The number of values can't change between executions.");
+        }
+
+        batch_.resize(rows);
+
+        for (std::size_t r = 0; r != rows; ++r)
+        {
+            values & v = v_[r];
+            if (v.uses_.size() != columns)
+            {
+                std::ostringstream msg;
+                msg << "Values at position " << static_cast<unsigned long>(r)
+                    << " don't have the same number of elements as the first ones";
+                throw soci_error(msg.str());
+            }
+
+            for (std::size_t c = 0; c != columns; ++c)
+            {
+                if (v.columnFactories_[c] != batch_.get_factory(c))
+                {
+                    std::ostringstream msg;
+                    msg << "Value " << static_cast<unsigned long>(c)
+                        << " at position " << static_cast<unsigned long>(r)
+                        << " was set using a different type than in the first"
+                           " values";
+                    throw soci_error(msg.str());
+                }
+
+                batch_.get_column(c).gather(v, c, r);
+            }
+        }
+    }
+
+    std::vector<values> & v_;
+    std::size_t * end_;
+    values_batch batch_;
+
+    SOCI_NOT_COPYABLE(use_type)
 };
 
 template <>
@@ -135,12 +290,109 @@ private:
     SOCI_NOT_COPYABLE(into_type)
 };
 
-// this is not supposed to be used - no support for bulk ORM
+// Bulk select into values: the columns of the result set are described when
+// the statement is executed and fetched into the columns of a values_batch,
+// which are then copied into the elements of the vector.
 template <>
-class into_type<std::vector<values> >
+class into_type<std::vector<values> > : public into_type_base
 {
+public:
+    into_type(std::vector<values> & v)
+        : v_(v), ind_(NULL), end_(NULL)
+    {}
+
+    into_type(std::vector<values> & v, std::size_t /*begin*/, std::size_t * end)
+        : v_(v), ind_(NULL), end_(end)
+    {}
+
+    into_type(std::vector<values> & v, std::vector<indicator> & ind)
+        : v_(v), ind_(&ind), end_(NULL)
+    {}
+
+    into_type(std::vector<values> & v, std::vector<indicator> & ind,
+        std::size_t /*begin*/, std::size_t * end)
+        : v_(v), ind_(&ind), end_(end)
+    {}
+
+protected:
+    void define(statement_impl & st, int & /* position */) SOCI_OVERRIDE
+    {
+        if (end_ != NULL)
+        {
+            throw soci_error("Vector ranges are not supported with values.");
+        }
+
+        st.set_values_batch(&batch_);
+
+        // actual columns description is performed
+        // as part of the statement execute
+    }
+
+    void pre_exec(int /* num */) SOCI_OVERRIDE {}
+    void pre_fetch() SOCI_OVERRIDE {}
+
+    void post_fetch(bool gotData, bool /* calledFromFetch */) SOCI_OVERRIDE
+    {
+        if (gotData == false)
+        {
+            return;
+        }
+
+        std::size_t const rows = v_.size();
+        std::size_t const columns = batch_.get_number_of_columns();
+        for (std::size_t r = 0; r != rows; ++r)
+        {
+            values & v = v_[r];
+
+            v.reset_set_counter();
+            v.reset_get_counter();
+
+            for (std::size_t c = 0; c != columns; ++c)
+            {
+                batch_.get_column(c).scatter(v, batch_.get_name(c), r);
+            }
+
+            if (ind_ != NULL)
+            {
+                (*ind_)[r] = i_ok;
+            }
+        }
+
+        // this is used only to re-dispatch to derived class, if any
+        // (the derived class might be generated automatically by
+        // user conversions)
+        convert_from_base();
+    }
+
+    void clean_up() SOCI_OVERRIDE
+    {
+        std::size_t const sz = v_.size();
+        for (std::size_t i = 0; i != sz; ++i)
+        {
+            v_[i].clean_up();
+        }
+    }
+
+    std::size_t size() const SOCI_OVERRIDE { return v_.size(); }
+
+    void resize(std::size_t sz) SOCI_OVERRIDE
+    {
+        v_.resize(sz);
+        if (ind_ != NULL)
+        {
+            ind_->resize(sz);
+        }
+    }
+
+    virtual void convert_from_base() {}
+
 private:
-    into_type();
+    std::vector<values> & v_;
+    std::vector<indicator> * ind_;
+    std::size_t * end_;
+    values_batch batch_;
+
+    SOCI_NOT_COPYABLE(into_type)
 };
 
 } // namespace details
@@ -13,7 +13,6 @@
 #include "soci/use-type.h"
 // std
 #include <cstddef>
-#include <map>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -25,20 +24,48 @@ namespace soci
 namespace details
 {
 
-class copy_base
+// This class is used to ensure that the value and the indicator are
+// constructed before the use_type referencing them in owned_use_type below.
+template <typename T>
+struct owned_value_holder
 {
-public:
-    virtual ~copy_base() {}
+    owned_value_holder(indicator ind) : value_(), ind_(ind) {}
+
+    T value_;
+    indicator ind_;
 };
 
+// Use element owning the value and the indicator it refers to, so that each
+// value stored in values requires a single allocation which, moreover, is
+// reused when the value is set again for the next row.
 template <typename T>
-struct copy_holder : public copy_base
+class owned_use_type
+    : private owned_value_holder<T>,
+      public use_type<T>
 {
-    copy_holder(T const & v) : value_(v) {}
+public:
+    owned_use_type(indicator ind, std::string const & name = std::string())
+        : owned_value_holder<T>(ind),
+          use_type<T>(owned_value_holder<T>::value_,
+                      owned_value_holder<T>::ind_, name)
+    {}
 
-    T value_;
+    T & value() { return owned_value_holder<T>::value_; }
+    indicator & ind() { return owned_value_holder<T>::ind_; }
+
+private:
+    SOCI_NOT_COPYABLE(owned_use_type)
 };
 
+class values_column_base;
+
+// Function creating the column suitable for storing the values of the given
+// type, also used to identify the type of the values stored in values.
+typedef values_column_base * (*values_column_factory)();
+
+template <typename T>
+class values_column;
+
 } // namespace details
 
 class SOCI_DECL values
@@ -46,10 +73,41 @@ class SOCI_DECL values
     friend class details::statement_impl;
     friend class details::into_type<values>;
     friend class details::use_type<values>;
+    friend class details::into_type<std::vector<values> >;
+    friend class details::use_type<std::vector<values> >;
+    template <typename T> friend class details::values_column;
 
 public:
 
-    values() : row_(NULL), currentPos_(0), uppercaseColumnNames_(false) {}
+    values()
+        : row_(NULL), currentPos_(0), setPos_(0), boundToStatement_(false),
+          uppercaseColumnNames_(false)
+    {}
+
+    // Copying values copies all the values set in it or the row it was
+    // selected into, but the copy is not bound to any statement.
+    values(values const & other)
+        : row_(NULL), currentPos_(0), setPos_(0), boundToStatement_(false),
+          uppercaseColumnNames_(other.uppercaseColumnNames_)
+    {
+        copy_from(other);
+    }
+
+    values & operator=(values const & other)
+    {
+        if (&other != this)
+        {
+            clean_up();
+            uppercaseColumnNames_ = other.uppercaseColumnNames_;
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    ~values()
+    {
+        clean_up();
+    }
 
     indicator get_indicator(std::size_t pos) const;
     indicator get_indicator(std::string const & name) const;
@@ -166,53 +224,57 @@ public:
     void set(std::string const & name, T const & value, indicator indic = i_ok)
     {
         typedef typename type_conversion<T>::base_type base_type;
-        if (index_.find(name) == index_.end())
-        {
-            index_.insert(std::make_pair(name, uses_.size()));
-
-            indicator * pind = new indicator(indic);
-            indicators_.push_back(pind);
-
-            base_type baseValue;
-            type_conversion<T>::to_base(value, baseValue, *pind);
 
-            details::copy_holder<base_type> * pcopy =
-                    new details::copy_holder<base_type>(baseValue);
-            deepCopies_.push_back(pcopy);
+        std::size_t const index = find_use(name);
+        if (index == uses_.size())
+        {
+            details::owned_use_type<base_type> * const u =
+                add_use(new details::owned_use_type<base_type>(indic, name),
+                        name,
+                        &details::values_column<base_type>::make);
 
-            uses_.push_back(new details::use_type<base_type>(
-                    pcopy->value_, *pind, name));
+            if (indic == i_ok)
+            {
+                type_conversion<T>::to_base(value, u->value(), u->ind());
+            }
         }
         else
         {
-            size_t index = index_.find(name)->second;
-            *indicators_[index] = indic;
+            details::owned_use_type<base_type> * const u =
+                reuse_use<base_type>(index, indic);
+
             if (indic == i_ok)
             {
-                type_conversion<T>::to_base(
-                        value,
-                        static_cast<details::copy_holder<base_type>*>(deepCopies_[index])->value_,
-                        *indicators_[index]);
+                type_conversion<T>::to_base(value, u->value(), u->ind());
             }
+
+            setPos_ = index + 1;
         }
     }
 
     template <typename T>
     void set(const T & value, indicator indic = i_ok)
     {
-        indicator * pind = new indicator(indic);
-        indicators_.push_back(pind);
-
         typedef typename type_conversion<T>::base_type base_type;
-        base_type baseValue;
-        type_conversion<T>::to_base(value, baseValue, *pind);
 
-        details::copy_holder<base_type> * pcopy =
-            new details::copy_holder<base_type>(baseValue);
-        deepCopies_.push_back(pcopy);
+        details::owned_use_type<base_type> * u;
+        if (setPos_ < uses_.size() && names_[setPos_].empty())
+        {
+            // reuse the element set at the same position for the previous row
+            u = reuse_use<base_type>(setPos_, indic);
+            ++setPos_;
+        }
+        else
+        {
+            u = add_use(new details::owned_use_type<base_type>(indic),
+                        std::string(),
+                        &details::values_column<base_type>::make);
+        }
 
-        uses_.push_back(new details::use_type<base_type>(
-                pcopy->value_, *pind));
+        if (indic == i_ok)
+        {
+            type_conversion<T>::to_base(value, u->value(), u->ind());
+        }
     }
 
     template <typename T>
@@ -240,14 +302,27 @@ private:
     //TODO To make values generally usable outside of type_conversion's,
     // these should be reference counted smart pointers
     row * row_;
+
+    // All these vectors are indexed by the position of the value, with
+    // names_ containing empty strings for the positional values, indicators_
+    // pointing to the indicators owned by the uses_ elements and bound_
+    // indicating whether the element is owned by the statement it was bound
+    // to (and will be deleted by it) or by this object.
     std::vector<details::standard_use_type *> uses_;
-    std::map<details::use_type_base *, indicator *> unused_;
     std::vector<indicator *> indicators_;
-    std::map<std::string, std::size_t> index_;
-    std::vector<details::copy_base *> deepCopies_;
+    std::vector<std::string> names_;
+    std::vector<details::values_column_factory> columnFactories_;
+    std::vector<bool> bound_;
 
     mutable std::size_t currentPos_;
 
+    // position of the next value expected to be set, used to reuse the
+    // existing elements when the values are set again for the next row
+    std::size_t setPos_;
+
+    // true once the elements were bound by a statement
+    bool boundToStatement_;
+
     bool uppercaseColumnNames_;
 
     // When type_conversion::to() is called, a values object is created
@@ -256,15 +331,15 @@ private:
     template <typename T>
     T get_from_uses(std::string const & name, T const & nullValue) const
     {
-        std::map<std::string, std::size_t>::const_iterator pos = index_.find(name);
-        if (pos != index_.end())
+        std::size_t const pos = find_use(name);
+        if (pos != uses_.size())
         {
-            if (*indicators_[pos->second] == i_null)
+            if (*indicators_[pos] == i_null)
             {
                 return nullValue;
             }
 
-            return get_from_uses<T>(pos->second);
+            return get_from_uses<T>(pos);
         }
         throw soci_error("Value named " + name + " not found.");
     }
@@ -272,10 +347,10 @@ private:
     template <typename T>
     T get_from_uses(std::string const & name) const
     {
-        std::map<std::string, std::size_t>::const_iterator pos = index_.find(name);
-        if (pos != index_.end())
+        std::size_t const pos = find_use(name);
+        if (pos != uses_.size())
         {
-            return get_from_uses<T>(pos->second);
+            return get_from_uses<T>(pos);
         }
         throw soci_error("Value named " + name + " not found.");
     }
@@ -287,7 +362,7 @@ private:
 
         typedef typename type_conversion<T>::base_type base_type;
 
-        if (dynamic_cast<details::use_type<base_type> *>(u))
+        if (dynamic_cast<details::owned_use_type<base_type> *>(u))
         {
             base_type const & baseValue = *static_cast<base_type*>(u->get_data());
 
@@ -315,11 +390,115 @@ private:
         return * row_;
     }
 
-    // this is called by Statement::bind(values)
-    void add_unused(details::use_type_base * u, indicator * i)
+    // Return the position of the value with the given name or uses_.size()
+    // if there is none.
+    std::size_t find_use(std::string const & name) const
+    {
+        // the values are normally set in the same order for all rows, so
+        // check the next expected position before looking everywhere else
+        std::size_t const count = names_.size();
+        if (setPos_ < count && names_[setPos_] == name)
+        {
+            return setPos_;
+        }
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (names_[i] == name)
+            {
+                return i;
+            }
+        }
+
+        return count;
+    }
+
+    // Return the existing element at the given position for reusing it if it
+    // has the right type or replace it with a new one of this type otherwise.
+    template <typename T>
+    details::owned_use_type<T> * reuse_use(std::size_t pos, indicator indic)
+    {
+        details::owned_use_type<T> * u =
+            dynamic_cast<details::owned_use_type<T> *>(uses_[pos]);
+        if (u != NULL)
+        {
+            u->ind() = indic;
+            return u;
+        }
+
+        // the statement has already bound the old element, so it can't be
+        // replaced without it noticing
+        if (bound_[pos])
+        {
+            std::ostringstream msg;
+            msg << "Value at position "
+                << static_cast<unsigned long>(pos)
+                << " can't be set using a different type"
+                   " after being bound to a statement";
+            throw soci_error(msg.str());
+        }
+
+        u = new details::owned_use_type<T>(indic, names_[pos]);
+        delete uses_[pos];
+        uses_[pos] = u;
+        indicators_[pos] = &u->ind();
+        columnFactories_[pos] = &details::values_column<T>::make;
+
+        return u;
+    }
+
+    template <typename T>
+    T * add_use(T * u, std::string const & name,
+        details::values_column_factory columnFactory)
     {
-        static_cast<details::standard_use_type *>(u)->convert_to_base();
-        unused_.insert(std::make_pair(u, i));
+        // take ownership of the new element before modifying anything
+        cxx_details::auto_ptr<T> owner(u);
+
+        // the statement only binds the elements existing when it is bound,
+        // so any new ones would be silently ignored by it
+        if (boundToStatement_)
+        {
+            throw soci_error("Value \"" + name + "\" can't be added to the"
+                             " values already bound to a statement.");
+        }
+
+        uses_.reserve(uses_.size() + 1);
+        indicators_.reserve(indicators_.size() + 1);
+        columnFactories_.reserve(columnFactories_.size() + 1);
+        bound_.reserve(bound_.size() + 1);
+        names_.push_back(name);
+
+        uses_.push_back(owner.release());
+        indicators_.push_back(&u->ind());
+        columnFactories_.push_back(columnFactory);
+        bound_.push_back(false);
+        setPos_ = uses_.size();
+
+        return u;
+    }
+
+    // copy the contents of other, which must be empty, into this object
+    void copy_from(values const & other);
+
+    // this is called by use_type<values> before converting the user object
+    // to values to start reusing the elements set for the previous row
+    void reset_set_counter()
+    {
+        setPos_ = 0;
+    }
+
+    // this is called by Statement::bind(values) for the elements it takes
+    // ownership of
+    void set_bound(std::size_t pos)
+    {
+        bound_[pos] = true;
+    }
+
+    // this is called by Statement::bind(values) once all the elements were
+    // bound, after which no new ones can be added
+    void set_bound_to_statement()
+    {
+        boundToStatement_ = true;
     }
 
     // this is called by details::into_type<values>::clean_up()
@@ -329,23 +508,184 @@ private:
         delete row_;
         row_ = NULL;
 
-        // delete any uses and indicators which were created  by set() but
-        // were not bound by the Statement
-        // (bound uses and indicators are deleted in Statement::clean_up())
-        for (std::map<details::use_type_base *, indicator *>::iterator pos =
-            unused_.begin(); pos != unused_.end(); ++pos)
+        // delete any uses (which own their indicators) which were created by
+        // set() but were not bound by the Statement (bound uses are deleted
+        // in Statement::clean_up())
+        for (std::size_t i = 0; i != uses_.size(); ++i)
         {
-            delete pos->first;
-            delete pos->second;
+            if (!bound_[i])
+            {
+                delete uses_[i];
+            }
         }
 
-        for (std::size_t i = 0; i != deepCopies_.size(); ++i)
+        uses_.clear();
+        indicators_.clear();
+        names_.clear();
+        columnFactories_.clear();
+        bound_.clear();
+        setPos_ = 0;
+        boundToStatement_ = false;
+    }
+};
+
+namespace details
+{
+
+// Column of values_batch storing the values of one column for all rows in a
+// vector, so that they can be exchanged using the vector into and use
+// elements.
+class values_column_base
+{
+public:
+    virtual ~values_column_base() {}
+
+    virtual void resize(std::size_t sz) = 0;
+
+    // copy the value at the given position in v to the given row
+    virtual void gather(values & v, std::size_t pos, std::size_t row) = 0;
+
+    // copy the given row to the value with the given name in v
+    virtual void scatter(values & v, std::string const & name,
+        std::size_t row) = 0;
+
+    // append a copy of the value at the given position in src to dst
+    virtual void copy_value(values const & src, std::size_t pos,
+        values & dst) = 0;
+
+    virtual into_type_base * make_into() = 0;
+    virtual use_type_base * make_use(std::string const & name) = 0;
+
+protected:
+    std::vector<indicator> inds_;
+};
+
+template <typename T>
+class values_column : public values_column_base
+{
+public:
+    static values_column_base * make() { return new values_column<T>(); }
+
+    void resize(std::size_t sz) SOCI_OVERRIDE
+    {
+        data_.resize(sz);
+        inds_.resize(sz);
+    }
+
+    void gather(values & v, std::size_t pos, std::size_t row) SOCI_OVERRIDE
+    {
+        owned_use_type<T> & u = static_cast<owned_use_type<T> &>(*v.uses_[pos]);
+
+        data_[row] = u.value();
+        inds_[row] = u.ind();
+    }
+
+    void scatter(values & v, std::string const & name,
+        std::size_t row) SOCI_OVERRIDE
+    {
+        v.set(name, data_[row], inds_[row]);
+    }
+
+    void copy_value(values const & src, std::size_t pos,
+        values & dst) SOCI_OVERRIDE
+    {
+        owned_use_type<T> & u =
+            static_cast<owned_use_type<T> &>(*src.uses_[pos]);
+
+        dst.add_use(new owned_use_type<T>(u.ind(), src.names_[pos]),
+                    src.names_[pos],
+                    &make)->value() = u.value();
+    }
+
+    into_type_base * make_into() SOCI_OVERRIDE
+    {
+        return new into_type<std::vector<T> >(data_, inds_);
+    }
+
+    use_type_base * make_use(std::string const & name) SOCI_OVERRIDE
+    {
+        return new use_type<std::vector<T> >(data_, inds_, name);
+    }
+
+private:
+    std::vector<T> data_;
+};
+
+// Columnar storage used for the bulk exchange of std::vector<values>.
+class values_batch
+{
+public:
+    values_batch() {}
+    ~values_batch() { clean_up(); }
+
+    void add_column(values_column_factory factory, std::string const & name)
+    {
+        cxx_details::auto_ptr<values_column_base> column(factory());
+
+        factories_.reserve(factories_.size() + 1);
+        columns_.reserve(columns_.size() + 1);
+        names_.push_back(name);
+
+        factories_.push_back(factory);
+        columns_.push_back(column.release());
+    }
+
+    std::size_t get_number_of_columns() const { return columns_.size(); }
+
+    values_column_base & get_column(std::size_t pos) { return *columns_[pos]; }
+    values_column_factory get_factory(std::size_t pos) const
+    {
+        return factories_[pos];
+    }
+    std::string const & get_name(std::size_t pos) const { return names_[pos]; }
+
+    void resize(std::size_t sz)
+    {
+        for (std::size_t i = 0; i != columns_.size(); ++i)
         {
-            delete deepCopies_[i];
+            columns_[i]->resize(sz);
         }
     }
+
+    void clean_up()
+    {
+        for (std::size_t i = 0; i != columns_.size(); ++i)
+        {
+            delete columns_[i];
+        }
+
+        columns_.clear();
+        factories_.clear();
+        names_.clear();
+    }
+
+private:
+    std::vector<values_column_base *> columns_;
+    std::vector<values_column_factory> factories_;
+    std::vector<std::string> names_;
+
+    SOCI_NOT_COPYABLE(values_batch)
 };
 
+} // namespace details
+
+inline void values::copy_from(values const & other)
+{
+    if (other.row_ != NULL)
+    {
+        row_ = other.row_->clone();
+    }
+
+    for (std::size_t i = 0; i != other.uses_.size(); ++i)
+    {
+        cxx_details::auto_ptr<details::values_column_base>
+            column(other.columnFactories_[i]());
+        column->copy_value(other, i, *this);
+    }
+
+    setPos_ = other.setPos_;
+}
+
 } // namespace soci
 
 #endif // SOCI_VALUES_H_INCLUDED
@@ -11,6 +11,7 @@
 #include "soci-exchange-cast.h"
 #include "soci-mktime.h"
 #include "common.h"
+#include <cstring>
 #include <ctime>
 
 using namespace soci;
@@ -36,6 +37,7 @@ void db2_standard_into_type_backend::define_by_pos(
         data = buf;
         break;
     case x_stdstring:
+    case x_stringref:
         cType = SQL_C_CHAR;
         // Patch: set to min between column size and 100MB (used ot be 32769)
         // Column size for text data type can be too large for buffer allocation
@@ -140,6 +142,13 @@ void db2_standard_into_type_backend::post_fetch(
                 throw soci_error("Buffer size overflow; maybe got too large string");
             }
         }
+        else if (type == x_stringref)
+        {
+            // the data remains valid until the next fetch overwrites buf
+            string_ref& s = exchange_type_cast<x_stringref>(data);
+            s.data = buf;
+            s.length = std::strlen(buf);
+        }
         else if (type == x_stdtm)
         {
             std::tm& t = exchange_type_cast<x_stdtm>(data);
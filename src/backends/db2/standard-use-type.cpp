@@ -75,6 +75,21 @@ void *db2_standard_use_type_backend::prepare_for_bind(
         ind = SQL_NTS;
     }
     break;
+    case x_stringref:
+    {
+        string_ref const& s = exchange_type_cast<x_stringref>(data);
+        sqlType = SQL_LONGVARCHAR;
+        cType = SQL_C_CHAR;
+        size = static_cast<SQLINTEGER>(s.length) + 1;
+        buf = new char[size];
+        if (s.length != 0)
+        {
+            memcpy(buf, s.data, s.length);
+        }
+        buf[s.length] = '\0';
+        ind = SQL_NTS;
+    }
+    break;
     case x_stdtm:
         {
             sqlType = SQL_TIMESTAMP;
@@ -104,6 +119,9 @@ void *db2_standard_use_type_backend::prepare_for_bind(
         break;
     case x_statement:
     case x_rowid:
+    case x_packedstrings:
+    case x_timestamp:
+    case x_decimal:
         break;
     }
 
@@ -8,6 +8,7 @@
 
 #define SOCI_DB2_SOURCE
 #include "soci/db2/soci-db2.h"
+#include "soci-exchange-cast.h"
 #include "soci-mktime.h"
 #include <cctype>
 #include <cstdio>
@@ -128,6 +129,21 @@ void db2_vector_into_type_backend::define_by_pos(
             data = buf;
         }
         break;
+    case x_packedstrings:
+        {
+            cType = SQL_C_CHAR;
+            std::size_t const vsize
+                = exchange_type_cast<x_packedstrings>(data).size();
+            colSize = statement_.column_size(position) + 1;
+            std::size_t bufSize = colSize * vsize;
+            buf = new char[bufSize];
+
+            prepare_indicators(vsize);
+
+            size = static_cast<SQLINTEGER>(colSize);
+            data = buf;
+        }
+        break;
     case x_stdtm:
         {
             cType = SQL_C_TYPE_TIMESTAMP;
@@ -151,6 +167,9 @@ void db2_vector_into_type_backend::define_by_pos(
     case x_blob:
     case x_xmltype:
     case x_longstring:
+    case x_stringref:
+    case x_timestamp:
+    case x_decimal:
         throw soci_error("Unsupported type for vector into parameter");
     }
 
@@ -188,15 +207,26 @@ void db2_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                 pos += colSize;
             }
         }
-        if (type == x_stdstring)
+        if (type == x_stdstring || type == x_packedstrings)
         {
-            std::vector<std::string> *vp
-                = static_cast<std::vector<std::string> *>(data);
-
-            std::vector<std::string> &v(*vp);
+            // exactly one of these pointers is non-null
+            std::vector<std::string> *vp = NULL;
+            packed_strings *pp = NULL;
+            std::size_t vsize;
+            if (type == x_stdstring)
+            {
+                vp = static_cast<std::vector<std::string> *>(data);
+                vsize = vp->size();
+            }
+            else
+            {
+                // all the values are appended to the buffer, start afresh
+                pp = &exchange_type_cast<x_packedstrings>(data);
+                pp->reset();
+                vsize = pp->size();
+            }
 
             const char *pos = buf;
-            std::size_t const vsize = v.size();
             for (std::size_t i = 0; i != vsize; ++i, pos += colSize)
             {
                 // See ODBC backend for explanation, this code for determining
@@ -204,7 +234,8 @@ void db2_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                 SQLLEN const len = indVec[i];
                 if (len == -1)
                 {
-                    v[i].clear();
+                    if (vp)
+                        (*vp)[i].clear();
                     continue;
                 }
 
@@ -218,7 +249,10 @@ void db2_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                     }
                 }
 
-                v[i].assign(pos, end - pos);
+                if (vp)
+                    (*vp)[i].assign(pos, end - pos);
+                else
+                    pp->set(i, pos, end - pos);
             }
         }
         else if (type == x_stdtm)
@@ -344,6 +378,12 @@ void db2_vector_into_type_backend::resize(std::size_t sz)
     case x_blob:      break; // not supported
     case x_xmltype:   break; // not supported
     case x_longstring:break; // not supported
+    case x_stringref: break; // not supported
+    case x_packedstrings:
+        exchange_type_cast<x_packedstrings>(data).resize(sz);
+        break;
+    case x_timestamp: break; // not supported
+    case x_decimal: break; // not supported
     }
 }
 
@@ -412,6 +452,12 @@ std::size_t db2_vector_into_type_backend::size()
     case x_blob:      break; // not supported
     case x_xmltype:   break; // not supported
     case x_longstring:break; // not supported
+    case x_stringref: break; // not supported
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data).size();
+        break;
+    case x_timestamp: break; // not supported
+    case x_decimal: break; // not supported
     }
 
     return sz;
@@ -9,6 +9,7 @@
 #define SOCI_DB2_SOURCE
 #include "soci/soci-platform.h"
 #include "soci/db2/soci-db2.h"
+#include "soci-exchange-cast.h"
 #include <cctype>
 #include <cstdio>
 #include <cstring>
@@ -160,6 +161,39 @@ void db2_vector_use_type_backend::prepare_for_bind(void *&data, SQLUINTEGER &siz
             size = static_cast<SQLINTEGER>(maxSize);
         }
         break;
+    case x_packedstrings:
+        {
+            sqlType = SQL_CHAR;
+            cType = SQL_C_CHAR;
+
+            packed_strings const &v = exchange_type_cast<x_packedstrings>(data);
+
+            std::size_t maxSize = 0;
+            std::size_t const vecSize = v.size();
+            prepare_indicators(vecSize);
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                std::size_t sz = v.length(i);
+                indVec[i] = static_cast<long>(sz);
+                maxSize = sz > maxSize ? sz : maxSize;
+            }
+
+            maxSize++; // For terminating nul.
+
+            buf = new char[maxSize * vecSize];
+            memset(buf, 0, maxSize * vecSize);
+
+            char *pos = buf;
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                memcpy(pos, v.data(i), v.length(i));
+                pos += maxSize;
+            }
+
+            data = buf;
+            size = static_cast<SQLINTEGER>(maxSize);
+        }
+        break;
     case x_stdtm:
         {
             std::vector<std::tm> *vp
@@ -183,6 +217,9 @@ void db2_vector_use_type_backend::prepare_for_bind(void *&data, SQLUINTEGER &siz
     case x_blob:      break; // not supported
     case x_xmltype:   break; // not supported
     case x_longstring:break; // not supported
+    case x_stringref: break; // not supported
+    case x_timestamp: break; // not supported
+    case x_decimal: break; // not supported
     }
 
     colSize = size;
@@ -300,7 +337,7 @@ void db2_vector_use_type_backend::pre_use(indicator const *ind)
             else
             {
             // for strings we have already set the values
-            if (type != x_stdstring)
+            if (type != x_stdstring && type != x_packedstrings)
                 {
                     indVec[i] = SQL_NTS;  // value is OK
                 }
@@ -314,7 +351,7 @@ void db2_vector_use_type_backend::pre_use(indicator const *ind)
         for (std::size_t i = 0; i != vsize; ++i)
         {
             // for strings we have already set the values
-            if (type != x_stdstring)
+            if (type != x_stdstring && type != x_packedstrings)
             {
                 indVec[i] = SQL_NTS;  // value is OK
             }
@@ -387,6 +424,12 @@ std::size_t db2_vector_use_type_backend::size()
     case x_blob:      break; // not supported
     case x_xmltype:   break; // not supported
     case x_longstring:break; // not supported
+    case x_stringref: break; // not supported
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data).size();
+        break;
+    case x_timestamp: break; // not supported
+    case x_decimal: break; // not supported
     }
 
     return sz;
@@ -12,9 +12,31 @@
 using namespace soci;
 using namespace soci::details::firebird;
 
+namespace
+{
+
+// Maximal size of a single segment, as its length is an unsigned short.
+std::size_t const maxSegmentSize = 0xFFFF;
+
+// Mode of isc_seek_blob() seeking from the beginning of the BLOB.
+short const seekFromHead = 0;
+
+} // namespace anonymous
+
+// The BLOB can be in one of the following states:
+//
+//  - new and empty: nothing is buffered and no BLOB exists in the database.
+//  - from_db_: refers to an existing BLOB which is read on demand, using
+//    bhp_ as read handle, without loading it in memory.
+//  - writing_: a new BLOB is being created using bhp_ and data is appended
+//    to it directly, i.e. without being buffered.
+//  - loaded_: the contents is kept in data_, this is used only when it is
+//    modified in other ways than appending to it.
+
 firebird_blob_backend::firebird_blob_backend(firebird_session_backend &session)
-	  : session_(session), bid_(), from_db_(false), bhp_(0), data_(),
-		loaded_(false), max_seg_size_(0)
+    : session_(session), bid_(), from_db_(false), bhp_(0), data_(),
+      loaded_(false), max_seg_size_(0), len_(0), pos_(0), stream_(false),
+      writing_(false)
 {}
 
 firebird_blob_backend::~firebird_blob_backend()
@@ -24,21 +46,34 @@ firebird_blob_backend::~firebird_blob_backend()
 
 std::size_t firebird_blob_backend::get_len()
 {
-    if (from_db_ && bhp_ == 0)
+    if (loaded_)
+    {
+        return data_.size();
+    }
+
+    if (from_db_)
     {
         open();
     }
 
-    return data_.size();
+    return len_;
 }
 
 std::size_t firebird_blob_backend::read(
     std::size_t offset, char * buf, std::size_t toRead)
 {
-    if (from_db_ && (loaded_ == false))
+    if (loaded_ == false)
     {
-        // this is blob fetched from database, but not loaded yet
-        load();
+        if (writing_)
+        {
+            // we can only read the data back once the BLOB is complete
+            finishWriting();
+        }
+
+        if (from_db_)
+        {
+            return readStream(offset, buf, toRead);
+        }
     }
 
     std::size_t size = data_.size();
@@ -65,12 +100,14 @@ std::size_t firebird_blob_backend::read(
 std::size_t firebird_blob_backend::write(std::size_t offset, char const * buf,
                                        std::size_t toWrite)
 {
-    if (from_db_ && (loaded_ == false))
+    if (loaded_ == false && offset == get_len())
     {
-        // this is blob fetched from database, but not loaded yet
-        load();
+        // writing at the end doesn't require buffering the existing data
+        return append(buf, toWrite);
     }
 
+    ensureBuffered();
+
     std::size_t size = data_.size();
 
     if (offset > size)
@@ -92,10 +129,17 @@ std::size_t firebird_blob_backend::write(std::size_t offset, char const * buf,
 std::size_t firebird_blob_backend::append(
     char const * buf, std::size_t toWrite)
 {
-    if (from_db_ && (loaded_ == false))
+    if (loaded_ == false)
     {
-        // this is blob fetched from database, but not loaded yet
-        load();
+        if (writing_ == false)
+        {
+            startWriting();
+        }
+
+        putSegments(buf, toWrite);
+        len_ += toWrite;
+
+        return toWrite;
     }
 
     std::size_t size = data_.size();
@@ -108,12 +152,20 @@ std::size_t firebird_blob_backend::append(
 
 void firebird_blob_backend::trim(std::size_t newLen)
 {
-    if (from_db_ && (loaded_ == false))
+    if (newLen == 0)
     {
-        // this is blob fetched from database, but not loaded yet
-        load();
+        // this is the same as starting with a new empty BLOB
+        cleanUp();
+        return;
     }
 
+    if (loaded_ == false && newLen == get_len())
+    {
+        return;
+    }
+
+    ensureBuffered();
+
     data_.resize(newLen);
 }
 
@@ -146,10 +198,23 @@ void firebird_blob_backend::open()
         throw_iscerror(stat);
     }
 
+    pos_ = 0;
+
     // get basic blob info
-    long blob_size = getBLOBInfo();
+    len_ = static_cast<std::size_t>(getBLOBInfo());
+}
 
-    data_.resize(blob_size);
+void firebird_blob_backend::closeHandle()
+{
+    if (bhp_ != 0)
+    {
+        ISC_STATUS stat[20];
+        if (isc_close_blob(stat, &bhp_))
+        {
+            throw_iscerror(stat);
+        }
+        bhp_ = 0;
+    }
 }
 
 void firebird_blob_backend::cleanUp()
@@ -157,34 +222,46 @@ void firebird_blob_backend::cleanUp()
     from_db_ = false;
     loaded_ = false;
     max_seg_size_ = 0;
+    len_ = 0;
+    pos_ = 0;
+    stream_ = false;
     data_.resize(0);
 
-    if (bhp_ != 0)
+    if (writing_)
     {
-        // close blob
+        writing_ = false;
+
+        // the BLOB being created is not needed any more
         ISC_STATUS stat[20];
-        if (isc_close_blob(stat, &bhp_))
+        if (isc_cancel_blob(stat, &bhp_))
         {
             throw_iscerror(stat);
         }
         bhp_ = 0;
     }
+
+    closeHandle();
 }
 
 // loads blob data into internal buffer
 void firebird_blob_backend::load()
 {
-    if (bhp_ == 0)
+    if (pos_ != 0)
     {
-        open();
+        // part of the data was already read, start from the beginning
+        closeHandle();
     }
 
+    open();
+
+    data_.resize(len_);
+
     ISC_STATUS stat[20];
     unsigned short bytes;
     std::vector<char>::size_type total_bytes = 0;
-    bool keep_reading = false;
+    bool keep_reading = data_.empty() == false;
 
-    do
+    while (keep_reading)
     {
         bytes = 0;
         // next segment of data
@@ -216,57 +293,303 @@ void firebird_blob_backend::load()
             throw_iscerror(stat);
         }
     }
-    while (keep_reading);
 
+    pos_ = total_bytes;
     loaded_ = true;
 }
 
-// this method saves BLOB content to database
-// (a new BLOB will be created at this point)
-// BLOB will be closed after save.
-void firebird_blob_backend::save()
+// switches to keeping the BLOB contents in memory, this is needed for the
+// modifications other than appending to it
+void firebird_blob_backend::ensureBuffered()
+{
+    if (loaded_)
+    {
+        return;
+    }
+
+    if (writing_)
+    {
+        // read back the data written so far
+        finishWriting();
+    }
+
+    if (from_db_)
+    {
+        load();
+    }
+    else
+    {
+        // new empty BLOB
+        loaded_ = true;
+    }
+}
+
+// reads the data from the database BLOB without loading all of it
+std::size_t firebird_blob_backend::readStream(
+    std::size_t offset, char * buf, std::size_t toRead)
+{
+    open();
+
+    if (offset > len_)
+    {
+        throw soci_error("Can't read past-the-end of BLOB data");
+    }
+
+    std::size_t const limit = len_ - offset < toRead ? len_ - offset : toRead;
+
+    seek(offset);
+
+    return readSegments(buf, limit);
+}
+
+std::size_t firebird_blob_backend::readSegments(char * buf, std::size_t toRead)
 {
-    // close old blob if necessary
     ISC_STATUS stat[20];
-    if (bhp_ != 0)
+    std::size_t total_bytes = 0;
+
+    while (total_bytes < toRead)
     {
-        if (isc_close_blob(stat, &bhp_))
+        std::size_t chunk = toRead - total_bytes;
+        if (chunk > maxSegmentSize)
+        {
+            chunk = maxSegmentSize;
+        }
+
+        unsigned short bytes = 0;
+        isc_get_segment(stat, &bhp_, &bytes,
+                        static_cast<unsigned short>(chunk), buf + total_bytes);
+
+        total_bytes += bytes;
+        pos_ += bytes;
+
+        if (stat[1] == isc_segstr_eof)
+        {
+            break;
+        }
+        else if (stat[1] != 0 && stat[1] != isc_segment)
         {
             throw_iscerror(stat);
         }
-        bhp_ = 0;
     }
 
-    // create new blob
-    if (isc_create_blob(stat, &session_.dbhp_, session_.current_transaction(),
-                        &bhp_, &bid_))
+    return total_bytes;
+}
+
+// positions the read handle at the given offset
+void firebird_blob_backend::seek(std::size_t offset)
+{
+    if (offset == pos_)
     {
+        return;
+    }
+
+    if (stream_)
+    {
+        ISC_STATUS stat[20];
+        ISC_LONG result = 0;
+        if (isc_seek_blob(stat, &bhp_, seekFromHead,
+                          static_cast<ISC_LONG>(offset), &result))
+        {
+            throw_iscerror(stat);
+        }
+
+        pos_ = static_cast<std::size_t>(result);
+        return;
+    }
+
+    // segmented BLOBs can only be read sequentially, so reopen the BLOB to
+    // go backwards and skip the data to go forward
+    if (offset < pos_)
+    {
+        closeHandle();
+        open();
+    }
+
+    std::vector<char> skipped(
+        offset - pos_ < maxSegmentSize ? offset - pos_ : maxSegmentSize);
+    while (pos_ < offset)
+    {
+        std::size_t chunk = offset - pos_;
+        if (chunk > skipped.size())
+        {
+            chunk = skipped.size();
+        }
+
+        if (readSegments(&skipped[0], chunk) == 0)
+        {
+            throw soci_error("Unexpected end of BLOB data");
+        }
+    }
+}
+
+// creates a new BLOB in the database using bhp_
+void firebird_blob_backend::createBlob()
+{
+    // create stream BLOBs to allow seeking in them when reading them later
+    char const bpb[] =
+    {
+        isc_bpb_version1,
+        isc_bpb_type, 1, isc_bpb_type_stream
+    };
+
+    ISC_STATUS stat[20];
+    if (isc_create_blob2(stat, &session_.dbhp_, session_.current_transaction(),
+                         &bhp_, &bid_, sizeof(bpb), bpb))
+    {
+        bhp_ = 0;
         throw_iscerror(stat);
     }
+}
 
-    if (data_.size() > 0)
+// starts creating a new BLOB to which the data will be appended directly,
+// copying the existing data, if any, to it without buffering all of it
+void firebird_blob_backend::startWriting()
+{
+    ISC_QUAD const srcId = bid_;
+    isc_blob_handle src = 0;
+    if (from_db_)
     {
-        // write data
-        size_t size = data_.size();
-        size_t offset = 0;
-        // Segment Size : Specifying the BLOB segment is throwback to times past, when applications for working 
-        // with BLOB data were written in C(Embedded SQL) with the help of the gpre pre - compiler.
-        // Nowadays, it is effectively irrelevant.The segment size for BLOB data is determined by the client side and is usually larger than the data page size, 
-        // in any case.
-        do
+        closeHandle();
+        open();
+
+        src = bhp_;
+        bhp_ = 0;
+    }
+
+    std::size_t copied = 0;
+    try
+    {
+        createBlob();
+        writing_ = true;
+
+        if (src != 0)
         {
-            unsigned short segmentSize = 0xFFFF; //last unsigned short number
-            if (size - offset < segmentSize) //if content size is less than max segment size or last data segment is about to be written
-                segmentSize = static_cast<unsigned short>(size - offset); 
-            //write segment
-            if (isc_put_segment(stat, &bhp_, segmentSize, &data_[0]+offset))
+            std::vector<char> chunk(maxSegmentSize);
+
+            ISC_STATUS stat[20];
+            for (;;)
+            {
+                unsigned short bytes = 0;
+                isc_get_segment(stat, &src, &bytes,
+                    static_cast<unsigned short>(chunk.size()), &chunk[0]);
+
+                if (bytes != 0)
+                {
+                    putSegments(&chunk[0], bytes);
+                    copied += bytes;
+                }
+
+                if (stat[1] == isc_segstr_eof)
+                {
+                    break;
+                }
+                else if (stat[1] != 0 && stat[1] != isc_segment)
+                {
+                    throw_iscerror(stat);
+                }
+            }
+
+            if (isc_close_blob(stat, &src))
             {
                 throw_iscerror(stat);
             }
-            offset += segmentSize;
-        } 
-        while (offset < size);
+        }
     }
+    catch (...)
+    {
+        // leave the object in its original state
+        ISC_STATUS stat[20];
+        if (writing_)
+        {
+            writing_ = false;
+            isc_cancel_blob(stat, &bhp_);
+            bhp_ = 0;
+        }
+
+        if (src != 0)
+        {
+            isc_close_blob(stat, &src);
+        }
+
+        bid_ = srcId;
+
+        throw;
+    }
+
+    from_db_ = false;
+    len_ = copied;
+    pos_ = 0;
+}
+
+// closes the BLOB being created, which makes it a database BLOB
+void firebird_blob_backend::finishWriting()
+{
+    writing_ = false;
+    closeHandle();
+
+    from_db_ = true;
+    pos_ = 0;
+}
+
+void firebird_blob_backend::putSegments(char const * buf, std::size_t size)
+{
+    // Segment Size : Specifying the BLOB segment is throwback to times past, when applications for working
+    // with BLOB data were written in C(Embedded SQL) with the help of the gpre pre - compiler.
+    // Nowadays, it is effectively irrelevant.The segment size for BLOB data is determined by the client side and is usually larger than the data page size,
+    // in any case.
+    ISC_STATUS stat[20];
+    std::size_t offset = 0;
+    while (offset < size)
+    {
+        std::size_t segmentSize = size - offset;
+        if (segmentSize > maxSegmentSize)
+        {
+            segmentSize = maxSegmentSize;
+        }
+
+        //write segment
+        if (isc_put_segment(stat, &bhp_,
+                            static_cast<unsigned short>(segmentSize),
+                            buf + offset))
+        {
+            throw_iscerror(stat);
+        }
+        offset += segmentSize;
+    }
+}
+
+// this method saves BLOB content to database
+// (a new BLOB will be created at this point unless the contents was already
+// written to it or it wasn't modified at all)
+// BLOB will be closed after save.
+void firebird_blob_backend::save()
+{
+    if (writing_)
+    {
+        // all the data was already written, just complete the BLOB
+        finishWriting();
+        return;
+    }
+
+    // close old blob if necessary
+    closeHandle();
+
+    if (from_db_ && loaded_ == false)
+    {
+        // the existing BLOB wasn't modified and can be reused as is
+        pos_ = 0;
+        return;
+    }
+
+    // create new blob
+    createBlob();
+
+    if (data_.size() > 0)
+    {
+        // write data
+        putSegments(&data_[0], data_.size());
+    }
+
     cleanUp();
     from_db_ = true;
 }
@@ -275,8 +598,9 @@ void firebird_blob_backend::save()
 // returns total length of BLOB
 long firebird_blob_backend::getBLOBInfo()
 {
-    char blob_items[] = {isc_info_blob_max_segment, isc_info_blob_total_length};
-    char res_buffer[20], *p, item;
+    char blob_items[] = {isc_info_blob_max_segment, isc_info_blob_total_length,
+                         isc_info_blob_type};
+    char res_buffer[30], *p, item;
     short length;
     long total_length = 0;
 
@@ -301,6 +625,9 @@ long firebird_blob_backend::getBLOBInfo()
             case isc_info_blob_total_length:
                 total_length = isc_vax_integer(p, length);
                 break;
+            case isc_info_blob_type:
+                stream_ = isc_vax_integer(p, length) == isc_bpb_type_stream;
+                break;
             case isc_info_truncated:
                 throw soci_error("Fatal Error: BLOB info truncated!");
                 break;
@@ -98,7 +98,7 @@ void setTextParam(char const * s, std::size_t size, char * buf_,
         if (size > static_cast<std::size_t>(var->sqllen))
         {
             std::ostringstream msg;
-            msg << "Value \"" << s << "\" is too long ("
+            msg << "Value \"" << std::string(s, size) << "\" is too long ("
                 << size << " bytes) to be stored in column of size "
                 << var->sqllen << " bytes";
             throw soci_error(msg.str());
@@ -92,6 +92,27 @@ void firebird_standard_into_type_backend::exchangeData()
         case x_stdstring:
             exchange_type_cast<x_stdstring>(data_) = getTextParam(var);
             break;
+        case x_stringref:
+            {
+                // refer to the data in the row buffer directly, this is only
+                // possible for the text columns which don't need formatting
+                string_ref& ref = exchange_type_cast<x_stringref>(data_);
+                if ((var->sqltype & ~1) == SQL_VARYING)
+                {
+                    ref.data = var->sqldata + sizeof(short);
+                    ref.length = *reinterpret_cast<short*>(var->sqldata);
+                }
+                else if ((var->sqltype & ~1) == SQL_TEXT)
+                {
+                    ref.data = var->sqldata;
+                    ref.length = var->sqllen;
+                }
+                else
+                {
+                    throw soci_error("String reference used with non-text column.");
+                }
+            }
+            break;
         case x_stdtm:
             {
                 std::tm& t = exchange_type_cast<x_stdtm>(data_);
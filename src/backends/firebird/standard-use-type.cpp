@@ -126,6 +126,23 @@ void firebird_standard_use_type_backend::exchangeData()
                 setTextParam(tmp.c_str(), tmp.size(), buf_, var);
             }
             break;
+        case x_stringref:
+            {
+                string_ref const& tmp = exchange_type_cast<x_stringref>(data_);
+                int const sqltype = var->sqltype & ~1;
+                if (sqltype == SQL_VARYING || sqltype == SQL_TEXT)
+                {
+                    setTextParam(tmp.data, tmp.length, buf_, var);
+                }
+                else
+                {
+                    // values of other types are parsed from NUL-terminated
+                    // strings, so we need to make a copy here
+                    std::string const str = tmp.to_string();
+                    setTextParam(str.c_str(), str.size(), buf_, var);
+                }
+            }
+            break;
         case x_stdtm:
             tmEncode(var->sqltype, &exchange_type_cast<x_stdtm>(data_), buf_);
             break;
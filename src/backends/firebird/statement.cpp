@@ -9,6 +9,7 @@
 #include "soci/firebird/soci-firebird.h"
 #include "firebird/error-firebird.h"
 #include <cctype>
+#include <cstring>
 #include <sstream>
 #include <iostream>
 
@@ -176,17 +177,13 @@ namespace
     }
 }
 
-void firebird_statement_backend::rewriteQuery(
-    std::string const &query, std::vector<char> &buffer)
+void firebird_statement_backend::prepareQuery(std::string const & query)
 {
-    // buffer for temporary query
-    std::vector<char> tmpQuery;
-    std::vector<char>::iterator qItr;
-
     // buffer for query with named parameters changed to standard ones
     std::vector<char> rewQuery(query.size() + 1);
 
-    // take care of named parameters in original query
+    // take care of named parameters in original query, this is done on the
+    // client side to avoid preparing the query more than once
     rewriteParameters(query, rewQuery);
 
     std::string const prefix("execute procedure ");
@@ -194,96 +191,69 @@ void firebird_statement_backend::rewriteQuery(
 
     // for procedures, we are preparing statement to determine
     // type of procedure.
+    std::vector<char> buffer;
     if (procedure_)
     {
-        tmpQuery.resize(prefix.size() + rewQuery.size());
-        qItr = tmpQuery.begin();
-        std::copy(prefix.begin(), prefix.end(), qItr);
-        qItr += prefix.size();
+        buffer.resize(prefix.size() + rewQuery.size());
+        std::copy(prefix.begin(), prefix.end(), buffer.begin());
+        std::copy(rewQuery.begin(), rewQuery.end(),
+            buffer.begin() + prefix.size());
     }
     else
     {
-        tmpQuery.resize(rewQuery.size());
-        qItr = tmpQuery.begin();
+        buffer = rewQuery;
     }
 
-    // prepare temporary query
-    std::copy(rewQuery.begin(), rewQuery.end(), qItr);
-
     // preparing buffers for output parameters
     if (sqldap_ == NULL)
     {
         prepareSQLDA(&sqldap_);
     }
 
-    ISC_STATUS stat[stat_size];
-    isc_stmt_handle tmpStmtp = 0;
-
-    // allocate temporary statement to determine its type
-    if (isc_dsql_allocate_statement(stat, &session_.dbhp_, &tmpStmtp))
-    {
-        throw_iscerror(stat);
-    }
-
-    // prepare temporary statement
-    if (isc_dsql_prepare(stat, session_.current_transaction(), &tmpStmtp, 0,
-        &tmpQuery[0], SQL_DIALECT_V6, sqldap_))
-    {
-        throw_iscerror(stat);
-    }
-
-    // get statement type
-    int stType = statementType(tmpStmtp);
-
-    // free temporary prepared statement
-    if (isc_dsql_free_statement(stat, &tmpStmtp, DSQL_drop))
-    {
-        throw_iscerror(stat);
-    }
+    // prepare real statement, in the usual case this is the only time the
+    // query is prepared and its type and parameters are determined from it
+    doPrepare(buffer);
 
-    // take care of special cases
+    // take care of special cases, requiring preparing a different query
     if (procedure_)
     {
+        // that won't be needed anymore
+        procedure_ = false;
+
         // for procedures that return values, we need to use correct syntax
         if (sqldap_->sqld != 0)
         {
             // this is "select" procedure, so we have to change syntax
             buffer.resize(prefix2.size() + rewQuery.size());
-            qItr = buffer.begin();
-            std::copy(prefix2.begin(), prefix2.end(), qItr);
-            qItr += prefix2.size();
-            std::copy(rewQuery.begin(), rewQuery.end(), qItr);
-
-            // that won't be needed anymore
-            procedure_ = false;
+            std::copy(prefix2.begin(), prefix2.end(), buffer.begin());
+            std::copy(rewQuery.begin(), rewQuery.end(),
+                buffer.begin() + prefix2.size());
 
-            return;
+            doPrepare(buffer);
         }
     }
-    else
+    else if (std::strcmp(&rewQuery[0], query.c_str()) != 0 &&
+        statementType(stmtp_) == isc_info_sql_stmt_ddl)
     {
-        // this is not procedure, so syntax is ok except for named
-        // parameters in ddl
-        if (stType == isc_info_sql_stmt_ddl)
-        {
-            // this statement is a DDL - we can't rewrite named parameters
-            // so, we will use original query
-            buffer.resize(query.size() + 1);
-            std::copy(query.begin(), query.end(), buffer.begin());
+        // this statement is a DDL containing something looking like named
+        // parameters which we can't rewrite, so use original query
+        buffer.resize(query.size() + 1);
+        std::copy(query.begin(), query.end(), buffer.begin());
+        buffer[query.size()] = '\0';
 
-            // that won't be needed anymore
-            procedure_ = false;
-
-            return;
-        }
+        doPrepare(buffer);
     }
+}
 
-    // here we know, that temporary query is OK, so we leave it as is
-    buffer.resize(tmpQuery.size());
-    std::copy(tmpQuery.begin(), tmpQuery.end(), buffer.begin());
+void firebird_statement_backend::doPrepare(std::vector<char> & buffer)
+{
+    ISC_STATUS stat[stat_size];
 
-    // that won't be needed anymore
-    procedure_ = false;
+    if (isc_dsql_prepare(stat, session_.current_transaction(), &stmtp_, 0,
+        &buffer[0], SQL_DIALECT_V6, sqldap_))
+    {
+        throw_iscerror(stat);
+    }
 }
 
 void firebird_statement_backend::prepare(std::string const & query,
@@ -293,21 +263,11 @@ void firebird_statement_backend::prepare(std::string const & query,
     // clear named parametes
     names_.clear();
 
-    std::vector<char> queryBuffer;
-
-    // modify query's syntax and prepare buffer for use with
-    // firebird's api
-    rewriteQuery(query, queryBuffer);
+    // modify query's syntax for use with firebird's api and prepare it
+    prepareQuery(query);
 
     ISC_STATUS stat[stat_size];
 
-    // prepare real statement
-    if (isc_dsql_prepare(stat, session_.current_transaction(), &stmtp_, 0,
-        &queryBuffer[0], SQL_DIALECT_V6, sqldap_))
-    {
-        throw_iscerror(stat);
-    }
-
     if (sqldap_->sqln < sqldap_->sqld)
     {
         // sqlda is too small for all columns. it must be reallocated
@@ -486,6 +446,15 @@ firebird_statement_backend::fetch(int number)
         inds_[i].resize(number > 0 ? number : 1);
     }
 
+    if (intoType_ == eVector)
+    {
+        for (std::size_t i = 0; i != intos_.size(); ++i)
+        {
+            static_cast<firebird_vector_into_type_backend*>(
+                intos_[i])->startFetch();
+        }
+    }
+
     // Here we have to explicitly loop to achieve the effect of fetching
     // vector into elements. After each fetch, we have to exchange data
     // with into buffers.
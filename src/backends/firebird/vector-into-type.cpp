@@ -8,6 +8,7 @@
 #define SOCI_FIREBIRD_SOURCE
 #include "soci/firebird/soci-firebird.h"
 #include "firebird/common.h"
+#include "soci-exchange-cast.h"
 
 using namespace soci;
 using namespace soci::details;
@@ -37,6 +38,16 @@ void firebird_vector_into_type_backend::pre_fetch()
     // Nothing to do here.
 }
 
+// this is called by the statement before fetching each batch of rows
+void firebird_vector_into_type_backend::startFetch()
+{
+    if (type_ == x_packedstrings)
+    {
+        // all the values are appended to the buffer, start afresh
+        exchange_type_cast<x_packedstrings>(data_).reset();
+    }
+}
+
 namespace // anonymous
 {
 template <typename T>
@@ -91,6 +102,29 @@ void firebird_vector_into_type_backend::exchangeData(std::size_t row)
     case x_stdstring:
         setIntoVector(data_, row, getTextParam(var));
         break;
+    case x_packedstrings:
+        {
+            packed_strings &v = exchange_type_cast<x_packedstrings>(data_);
+
+            // copy the text columns directly from the fetch buffer, without
+            // going through a temporary string
+            short const sqltype = var->sqltype & ~1;
+            if (sqltype == SQL_VARYING)
+            {
+                v.set(row, var->sqldata + sizeof(short),
+                    *reinterpret_cast<short*>(var->sqldata));
+            }
+            else if (sqltype == SQL_TEXT)
+            {
+                v.set(row, var->sqldata, var->sqllen);
+            }
+            else
+            {
+                std::string const tmp = getTextParam(var);
+                v.set(row, tmp.data(), tmp.size());
+            }
+        }
+        break;
     case x_stdtm:
         {
             std::tm data = std::tm();
@@ -150,6 +184,9 @@ void firebird_vector_into_type_backend::resize(std::size_t sz)
     case x_stdstring:
         resizeVector<std::string> (data_, sz);
         break;
+    case x_packedstrings:
+        exchange_type_cast<x_packedstrings>(data_).resize(sz);
+        break;
     case x_stdtm:
         resizeVector<std::tm> (data_, sz);
         break;
@@ -183,6 +220,9 @@ std::size_t firebird_vector_into_type_backend::size()
     case x_stdstring:
         sz = getVectorSize<std::string> (data_);
         break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
     case x_stdtm:
         sz = getVectorSize<std::tm> (data_);
         break;
@@ -8,6 +8,7 @@
 #define SOCI_FIREBIRD_SOURCE
 #include "soci/firebird/soci-firebird.h"
 #include "firebird/common.h"
+#include "soci-exchange-cast.h"
 
 using namespace soci;
 using namespace soci::details;
@@ -146,6 +147,12 @@ void firebird_vector_use_type_backend::exchangeData(std::size_t row)
             setTextParam(tmp->c_str(), tmp->size(), buf_, var);
         }
         break;
+    case x_packedstrings:
+        {
+            packed_strings const &v = exchange_type_cast<x_packedstrings>(data_);
+            setTextParam(v.data(row), v.length(row), buf_, var);
+        }
+        break;
     case x_stdtm:
         tmEncode(var->sqltype,
             getUseVectorValue<std::tm>(data_, row), buf_);
@@ -182,6 +189,9 @@ std::size_t firebird_vector_use_type_backend::size()
     case x_stdstring:
         sz = getVectorSize<std::string> (data_);
         break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
     case x_stdtm:
         sz = getVectorSize<std::tm> (data_);
         break;
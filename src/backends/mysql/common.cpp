@@ -6,6 +6,7 @@
 //
 
 #include "common.h"
+#include "soci-mktime.h"
 #include <ciso646>
 #include <cstdlib>
 #include <cstring>
@@ -21,3 +22,14 @@ char * soci::details::mysql::quote(MYSQL * conn, const char *s, size_t len)
 
     return retv;
 }
+
+char * soci::details::mysql::quote_timestamp(timestamp const & ts)
+{
+    char *retv = new char[timestamp_buffer_size + 2];
+    retv[0] = '\'';
+    std::size_t const len = format_timestamp(retv + 1, ts);
+    retv[len + 1] = '\'';
+    retv[len + 2] = '\0';
+
+    return retv;
+}
@@ -9,6 +9,8 @@
 #define SOCI_MYSQL_COMMON_H_INCLUDED
 
 #include "soci/mysql/soci-mysql.h"
+#include "soci/type-wrappers.h"
+#include "soci-decimal.h"
 #include "soci-cstrtod.h"
 #include "soci-compiler.h"
 // std
@@ -73,6 +75,9 @@ void parse_num(char const *buf, double &x)
 // helper for escaping strings
 char * quote(MYSQL * conn, const char *s, size_t len);
 
+// helper for formatting timestamps as quoted literals
+char * quote_timestamp(timestamp const & ts);
+
 // helper for vector operations
 template <typename T>
 std::size_t get_vector_size(void *p)
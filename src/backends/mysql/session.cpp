@@ -342,6 +342,7 @@ mysql_session_backend::mysql_session_backend(
         &read_timeout, &read_timeout_p,
         &write_timeout, &write_timeout_p);
     conn_ = mysql_init(NULL);
+    utcTimeZone_ = false;
     if (conn_ == NULL)
     {
         throw soci_error("mysql_init() failed.");
@@ -447,6 +448,17 @@ void hard_exec(MYSQL *conn, const string & query)
 
 } // namespace unnamed
 
+void mysql_session_backend::use_utc_time_zone()
+{
+    if (utcTimeZone_)
+    {
+        return;
+    }
+
+    hard_exec(conn_, "SET time_zone = '+00:00'");
+    utcTimeZone_ = true;
+}
+
 void mysql_session_backend::begin()
 {
     hard_exec(conn_, "BEGIN");
@@ -33,6 +33,10 @@ void mysql_standard_into_type_backend::define_by_pos(
 {
     data_ = data;
     type_ = type;
+    if (type == x_timestamp)
+    {
+        statement_.hasTimestamps_ = true;
+    }
     position_ = position++;
 }
 
@@ -89,6 +93,16 @@ void mysql_standard_into_type_backend::post_fetch(
                 dest.assign(buf, lengths[pos]);
             }
             break;
+        case x_stringref:
+            {
+                // the data remains valid until the result is freed
+                string_ref& dest = exchange_type_cast<x_stringref>(data_);
+                unsigned long * lengths =
+                    mysql_fetch_lengths(statement_.result_);
+                dest.data = buf;
+                dest.length = lengths[pos];
+            }
+            break;
         case x_short:
             parse_num(buf, exchange_type_cast<x_short>(data_));
             break;
@@ -108,6 +122,12 @@ void mysql_standard_into_type_backend::post_fetch(
             // attempt to parse the string and convert to std::tm
             parse_std_tm(buf, exchange_type_cast<x_stdtm>(data_));
             break;
+        case x_timestamp:
+            parse_timestamp(buf, exchange_type_cast<x_timestamp>(data_));
+            break;
+        case x_decimal:
+            parse_decimal(buf, exchange_type_cast<x_decimal>(data_));
+            break;
         default:
             throw soci_error("Into element used with non-supported type.");
         }
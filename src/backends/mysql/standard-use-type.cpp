@@ -28,6 +28,10 @@ void mysql_standard_use_type_backend::bind_by_pos(
 {
     data_ = data;
     type_ = type;
+    if (type == x_timestamp)
+    {
+        statement_.hasTimestamps_ = true;
+    }
     position_ = position++;
 }
 
@@ -36,6 +40,10 @@ void mysql_standard_use_type_backend::bind_by_name(
 {
     data_ = data;
     type_ = type;
+    if (type == x_timestamp)
+    {
+        statement_.hasTimestamps_ = true;
+    }
     name_ = name;
 }
 
@@ -64,6 +72,12 @@ void mysql_standard_use_type_backend::pre_use(indicator const *ind)
                              s.c_str(), s.size());
             }
             break;
+        case x_stringref:
+            {
+                string_ref const& s = exchange_type_cast<x_stringref>(data_);
+                buf_ = quote(statement_.session_.conn_, s.data, s.length);
+            }
+            break;
         case x_short:
             {
                 std::size_t const bufSize
@@ -126,6 +140,13 @@ void mysql_standard_use_type_backend::pre_use(indicator const *ind)
                     t.tm_hour, t.tm_min, t.tm_sec);
             }
             break;
+        case x_timestamp:
+            buf_ = quote_timestamp(exchange_type_cast<x_timestamp>(data_));
+            break;
+        case x_decimal:
+            buf_ = new char[decimal_buffer_size];
+            format_decimal(buf_, exchange_type_cast<x_decimal>(data_));
+            break;
         default:
             throw soci_error("Use element used with non-supported type.");
         }
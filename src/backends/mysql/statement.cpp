@@ -21,7 +21,8 @@ mysql_statement_backend::mysql_statement_backend(
     : session_(session), result_(NULL),
        rowsAffectedBulk_(-1LL), justDescribed_(false),
        hasIntoElements_(false), hasVectorIntoElements_(false),
-       hasUseElements_(false), hasVectorUseElements_(false)
+       hasUseElements_(false), hasVectorUseElements_(false),
+       hasTimestamps_(false)
 {
 }
 
@@ -40,6 +41,7 @@ void mysql_statement_backend::clean_up()
     {
         mysql_free_result(result_);
         result_ = NULL;
+        release_buffered_bytes();
     }
 }
 
@@ -154,6 +156,13 @@ mysql_statement_backend::execute(int number)
              numberOfExecutions = hasUseElements_ ? 1 : number;
         }
 
+        // MySQL converts TIMESTAMP values from and to the session time zone,
+        // while soci::timestamp values are always in UTC
+        if (hasTimestamps_)
+        {
+            session_.use_utc_time_zone();
+        }
+
         std::string query;
         if (not useByPosBuffers_.empty() or not useByNameBuffers_.empty())
         {
@@ -284,12 +293,40 @@ mysql_statement_backend::execute(int number)
         {
             // Cache the rows offsets to have random access to the rows later.
             // [mysql_data_seek() is O(n) so we don't want to use it].
+            // Also account for the memory used by the stored result.
             int numrows = static_cast<int>(mysql_num_rows(result_));
+            unsigned int const numfields = mysql_num_fields(result_);
+            bool const accountForMemory = is_fetch_memory_limited();
+            std::size_t bytes = 0;
             resultRowOffsets_.resize(numrows);
             for (int i = 0; i < numrows; i++)
             {
                 resultRowOffsets_[i] = mysql_row_tell(result_);
                 mysql_fetch_row(result_);
+
+                if (!accountForMemory)
+                {
+                    continue;
+                }
+
+                unsigned long const * const lengths =
+                    mysql_fetch_lengths(result_);
+                for (unsigned int j = 0; j < numfields; j++)
+                {
+                    bytes += lengths[j] + 1;
+                }
+            }
+
+            try
+            {
+                add_buffered_bytes(bytes);
+            }
+            catch (memory_limit_error const &)
+            {
+                mysql_free_result(result_);
+                result_ = NULL;
+                resultRowOffsets_.clear();
+                throw;
             }
         }
     }
@@ -8,6 +8,7 @@
 
 #define SOCI_MYSQL_SOURCE
 #include "soci/mysql/soci-mysql.h"
+#include "soci-exchange-cast.h"
 #include "soci-mktime.h"
 #include "common.h"
 #include "soci/soci-platform.h"
@@ -23,6 +24,10 @@ void mysql_vector_into_type_backend::define_by_pos(
 {
     data_ = data;
     type_ = type;
+    if (type == x_timestamp)
+    {
+        statement_.hasTimestamps_ = true;
+    }
     position_ = position++;
 }
 
@@ -58,6 +63,12 @@ void mysql_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
 
         int const endRow = statement_.currentRow_ + statement_.rowsToConsume_;
 
+        if (type_ == x_packedstrings)
+        {
+            // all the values are appended to the buffer, start from scratch
+            exchange_type_cast<x_packedstrings>(data_).reset();
+        }
+
         //mysql_data_seek(statement_.result_, statement_.currentRow_);
         mysql_row_seek(statement_.result_,
             statement_.resultRowOffsets_[statement_.currentRow_]);
@@ -108,6 +119,14 @@ void mysql_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                     (*dest)[i].assign(buf, lengths[pos]);
                 }
                 break;
+            case x_packedstrings:
+                {
+                    unsigned long * lengths =
+                        mysql_fetch_lengths(statement_.result_);
+                    exchange_type_cast<x_packedstrings>(data_).set(i,
+                        buf, lengths[pos]);
+                }
+                break;
             case x_short:
                 {
                     short val;
@@ -152,6 +171,22 @@ void mysql_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                     set_invector_(data_, i, t);
                 }
                 break;
+            case x_timestamp:
+                {
+                    timestamp ts;
+                    parse_timestamp(buf, ts);
+
+                    set_invector_(data_, i, ts);
+                }
+                break;
+            case x_decimal:
+                {
+                    decimal d;
+                    parse_decimal(buf, d);
+
+                    set_invector_(data_, i, d);
+                }
+                break;
 
             default:
                 throw soci_error("Into element used with non-supported type.");
@@ -191,6 +226,11 @@ void mysql_vector_into_type_backend::resize(std::size_t sz)
     case x_double:       resizevector_<double>       (data_, sz); break;
     case x_stdstring:    resizevector_<std::string>  (data_, sz); break;
     case x_stdtm:        resizevector_<std::tm>      (data_, sz); break;
+    case x_timestamp:    resizevector_<timestamp>    (data_, sz); break;
+    case x_decimal:      resizevector_<decimal>      (data_, sz); break;
+    case x_packedstrings:
+        exchange_type_cast<x_packedstrings>(data_).resize(sz);
+        break;
 
     default:
         throw soci_error("Into vector element used with non-supported type.");
@@ -213,6 +253,11 @@ std::size_t mysql_vector_into_type_backend::size()
     case x_double:       sz = get_vector_size<double>       (data_); break;
     case x_stdstring:    sz = get_vector_size<std::string>  (data_); break;
     case x_stdtm:        sz = get_vector_size<std::tm>      (data_); break;
+    case x_timestamp:    sz = get_vector_size<timestamp>    (data_); break;
+    case x_decimal:      sz = get_vector_size<decimal>      (data_); break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
 
     default:
         throw soci_error("Into vector element used with non-supported type.");
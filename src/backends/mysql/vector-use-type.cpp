@@ -11,6 +11,7 @@
 #include "common.h"
 #include "soci/soci-platform.h"
 #include "soci-dtocstr.h"
+#include "soci-exchange-cast.h"
 // std
 #include <ciso646>
 #include <cstddef>
@@ -32,6 +33,10 @@ void mysql_vector_use_type_backend::bind_by_pos(int &position, void *data,
 {
     data_ = data;
     type_ = type;
+    if (type == x_timestamp)
+    {
+        statement_.hasTimestamps_ = true;
+    }
     position_ = position++;
 }
 
@@ -40,6 +45,10 @@ void mysql_vector_use_type_backend::bind_by_name(
 {
     data_ = data;
     type_ = type;
+    if (type == x_timestamp)
+    {
+        statement_.hasTimestamps_ = true;
+    }
     name_ = name;
 }
 
@@ -81,6 +90,15 @@ void mysql_vector_use_type_backend::pre_use(indicator const *ind)
                         v[i].c_str(), v[i].size());
                 }
                 break;
+            case x_packedstrings:
+                {
+                    packed_strings const &v
+                        = exchange_type_cast<x_packedstrings>(data_);
+
+                    buf = quote(statement_.session_.conn_,
+                        v.data(i), v.length(i));
+                }
+                break;
             case x_short:
                 {
                     std::vector<short> *pv
@@ -161,6 +179,25 @@ void mysql_vector_use_type_backend::pre_use(indicator const *ind)
                         v[i].tm_hour, v[i].tm_min, v[i].tm_sec);
                 }
                 break;
+            case x_timestamp:
+                {
+                    std::vector<timestamp> *pv
+                        = static_cast<std::vector<timestamp> *>(data_);
+                    std::vector<timestamp> &v = *pv;
+
+                    buf = quote_timestamp(v[i]);
+                }
+                break;
+            case x_decimal:
+                {
+                    std::vector<decimal> *pv
+                        = static_cast<std::vector<decimal> *>(data_);
+                    std::vector<decimal> &v = *pv;
+
+                    buf = new char[decimal_buffer_size];
+                    format_decimal(buf, v[i]);
+                }
+                break;
 
             default:
                 throw soci_error(
@@ -199,6 +236,11 @@ std::size_t mysql_vector_use_type_backend::size()
     case x_double:       sz = get_vector_size<double>       (data_); break;
     case x_stdstring:    sz = get_vector_size<std::string>  (data_); break;
     case x_stdtm:        sz = get_vector_size<std::tm>      (data_); break;
+    case x_timestamp:    sz = get_vector_size<timestamp>    (data_); break;
+    case x_decimal:      sz = get_vector_size<decimal>      (data_); break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
 
     default:
         throw soci_error("Use vector element used with non-supported type.");
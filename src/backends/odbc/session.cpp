@@ -324,6 +324,63 @@ std::string odbc_session_backend::get_dummy_from_table() const
     return table;
 }
 
+std::string odbc_session_backend::set_savepoint(std::string const & name)
+{
+    switch (get_database_product())
+    {
+        case prod_mssql:
+            // MS SQL uses its own non-standard syntax for savepoints.
+            return "save transaction " + name;
+
+        case prod_db2:
+            return "savepoint " + name + " on rollback retain cursors";
+
+        case prod_firebird:
+        case prod_mysql:
+        case prod_oracle:
+        case prod_postgresql:
+        case prod_sqlite:
+        case prod_unknown:
+        case prod_uninitialized:
+            break;
+    }
+
+    return session_backend::set_savepoint(name);
+}
+
+std::string odbc_session_backend::release_savepoint(std::string const & name)
+{
+    // Neither MS SQL nor Oracle allow releasing savepoints explicitly.
+    switch (get_database_product())
+    {
+        case prod_mssql:
+        case prod_oracle:
+            return std::string();
+
+        case prod_db2:
+        case prod_firebird:
+        case prod_mysql:
+        case prod_postgresql:
+        case prod_sqlite:
+        case prod_unknown:
+        case prod_uninitialized:
+            break;
+    }
+
+    return session_backend::release_savepoint(name);
+}
+
+std::string
+odbc_session_backend::rollback_to_savepoint(std::string const & name)
+{
+    if (get_database_product() == prod_mssql)
+    {
+        return "rollback transaction " + name;
+    }
+
+    return session_backend::rollback_to_savepoint(name);
+}
+
 void odbc_session_backend::reset_transaction()
 {
     SQLRETURN rc = SQLSetConnectAttr( hdbc_, SQL_ATTR_AUTOCOMMIT,
@@ -8,8 +8,10 @@
 #define SOCI_ODBC_SOURCE
 #include "soci/soci-platform.h"
 #include "soci/odbc/soci-odbc.h"
+#include "soci-decimal.h"
 #include "soci-exchange-cast.h"
 #include "soci-mktime.h"
+#include <cstring>
 #include <ctime>
 #include <stdio.h>  // sscanf()
 
@@ -35,6 +37,7 @@ void odbc_standard_into_type_backend::define_by_pos(
     case x_stdstring:
     case x_longstring:
     case x_xmltype:
+    case x_stringref:
         odbcType_ = SQL_C_CHAR;
         // Patch: set to min between column size and 100MB (used ot be 32769)
         // Column size for text data type can be too large for buffer allocation
@@ -85,11 +88,21 @@ void odbc_standard_into_type_backend::define_by_pos(
         size = sizeof(double);
         break;
     case x_stdtm:
+    case x_timestamp:
         odbcType_ = SQL_C_TYPE_TIMESTAMP;
         size = sizeof(TIMESTAMP_STRUCT);
         buf_ = new char[size];
         data = buf_;
         break;
+    case x_decimal:
+        // Fetch decimals as strings, which can be parsed exactly, instead of
+        // using SQL_C_NUMERIC which requires setting the precision and scale
+        // in the application row descriptor for each column.
+        odbcType_ = SQL_C_CHAR;
+        size = max_decimal_length;
+        buf_ = new char[size];
+        data = buf_;
+        break;
     case x_rowid:
         odbcType_ = SQL_C_ULONG;
         size = sizeof(unsigned long);
@@ -161,6 +174,13 @@ void odbc_standard_into_type_backend::post_fetch(
                 throw soci_error("Buffer size overflow; maybe got too large string");
             }
         }
+        else if (type_ == x_stringref)
+        {
+            // the data remains valid until the next fetch overwrites buf_
+            string_ref& s = exchange_type_cast<x_stringref>(data_);
+            s.data = buf_;
+            s.length = std::strlen(buf_);
+        }
         else if (type_ == x_longstring)
         {
             exchange_type_cast<x_longstring>(data_).value = buf_;
@@ -179,6 +199,20 @@ void odbc_standard_into_type_backend::post_fetch(
                                         ts->year, ts->month, ts->day,
                                         ts->hour, ts->minute, ts->second);
         }
+        else if (type_ == x_timestamp)
+        {
+            TIMESTAMP_STRUCT * ts = reinterpret_cast<TIMESTAMP_STRUCT*>(buf_);
+
+            // ODBC fraction is in nanoseconds
+            exchange_type_cast<x_timestamp>(data_).microseconds =
+                details::timestamp_from_ymdhms(ts->year, ts->month, ts->day,
+                                               ts->hour, ts->minute, ts->second,
+                                               ts->fraction / 1000);
+        }
+        else if (type_ == x_decimal)
+        {
+            details::parse_decimal(buf_, exchange_type_cast<x_decimal>(data_));
+        }
         else if (type_ == x_long_long && use_string_for_bigint())
         {
           long long& ll = exchange_type_cast<x_long_long>(data_);
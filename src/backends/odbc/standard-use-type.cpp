@@ -6,7 +6,9 @@
 #define SOCI_ODBC_SOURCE
 #include "soci/soci-platform.h"
 #include "soci/odbc/soci-odbc.h"
+#include "soci-decimal.h"
 #include "soci-exchange-cast.h"
+#include "soci-mktime.h"
 #include <cctype>
 #include <cstdio>
 #include <cstring>
@@ -87,7 +89,14 @@ void* odbc_standard_use_type_backend::prepare_for_bind(
     {
         std::string const& s = exchange_type_cast<x_stdstring>(data_);
 
-        copy_from_string(s, size, sqlType, cType);
+        copy_from_string(s.c_str(), s.size(), size, sqlType, cType);
+    }
+    break;
+    case x_stringref:
+    {
+        string_ref const& s = exchange_type_cast<x_stringref>(data_);
+
+        copy_from_string(s.data, s.length, size, sqlType, cType);
     }
     break;
     case x_stdtm:
@@ -112,13 +121,49 @@ void* odbc_standard_use_type_backend::prepare_for_bind(
         ts->fraction = 0;
     }
     break;
+    case x_timestamp:
+    {
+        sqlType = SQL_TIMESTAMP;
+        cType = SQL_C_TIMESTAMP;
+        buf_ = new char[sizeof(TIMESTAMP_STRUCT)];
+        size = 26; // yyyy-mm-dd hh:mm:ss.ffffff
+
+        TIMESTAMP_STRUCT * ts = reinterpret_cast<TIMESTAMP_STRUCT*>(buf_);
+
+        int year, month, day, hour, minute, second, microsecond;
+        timestamp_to_ymdhms(exchange_type_cast<x_timestamp>(data_).microseconds,
+                            year, month, day, hour, minute, second, microsecond);
+
+        ts->year = static_cast<SQLSMALLINT>(year);
+        ts->month = static_cast<SQLUSMALLINT>(month);
+        ts->day = static_cast<SQLUSMALLINT>(day);
+        ts->hour = static_cast<SQLUSMALLINT>(hour);
+        ts->minute = static_cast<SQLUSMALLINT>(minute);
+        ts->second = static_cast<SQLUSMALLINT>(second);
+        ts->fraction = static_cast<SQLUINTEGER>(microsecond) * 1000;
+    }
+    break;
+    case x_decimal:
+    {
+        // Pass the exact text representation and let the database convert
+        // it to the type of the column.
+        sqlType = SQL_VARCHAR;
+        cType = SQL_C_CHAR;
+        buf_ = new char[decimal_buffer_size];
+        size = static_cast<SQLLEN>(
+            format_decimal(buf_, exchange_type_cast<x_decimal>(data_)));
+        indHolder_ = SQL_NTS;
+    }
+    break;
 
     case x_longstring:
-        copy_from_string(exchange_type_cast<x_longstring>(data_).value,
+        copy_from_string(exchange_type_cast<x_longstring>(data_).value.c_str(),
+                         exchange_type_cast<x_longstring>(data_).value.size(),
                          size, sqlType, cType);
         break;
     case x_xmltype:
-        copy_from_string(exchange_type_cast<x_xmltype>(data_).value,
+        copy_from_string(exchange_type_cast<x_xmltype>(data_).value.c_str(),
+                         exchange_type_cast<x_xmltype>(data_).value.size(),
                          size, sqlType, cType);
         break;
 
@@ -133,17 +178,21 @@ void* odbc_standard_use_type_backend::prepare_for_bind(
 }
 
 void odbc_standard_use_type_backend::copy_from_string(
-        std::string const& s,
+        char const* s,
+        std::size_t len,
         SQLLEN& size,
         SQLSMALLINT& sqlType,
         SQLSMALLINT& cType
     )
 {
-    size = s.size();
+    size = static_cast<SQLLEN>(len);
     sqlType = size > ODBC_MAX_COL_SIZE ? SQL_LONGVARCHAR : SQL_VARCHAR;
     cType = SQL_C_CHAR;
     buf_ = new char[size+1];
-    memcpy(buf_, s.c_str(), size);
+    if (len != 0)
+    {
+        memcpy(buf_, s, len);
+    }
     buf_[size++] = '\0';
     indHolder_ = SQL_NTS;
 }
@@ -211,10 +260,13 @@ void odbc_standard_use_type_backend::pre_use(indicator const *ind)
 
     void* const sqlData = prepare_for_bind(size, sqlType, cType);
 
+    // only timestamps need the digits of fractional seconds
+    SQLSMALLINT const decimalDigits = type_ == x_timestamp ? 6 : 0;
+
     SQLRETURN rc = SQLBindParameter(statement_.hstmt_,
                                     static_cast<SQLUSMALLINT>(position_),
                                     SQL_PARAM_INPUT,
-                                    cType, sqlType, size, 0,
+                                    cType, sqlType, size, decimalDigits,
                                     sqlData, bufLen, &indHolder_);
 
     if (is_odbc_error(rc))
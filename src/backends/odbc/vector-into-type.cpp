@@ -8,6 +8,8 @@
 #define SOCI_ODBC_SOURCE
 #include "soci/soci-platform.h"
 #include "soci/odbc/soci-odbc.h"
+#include "soci-decimal.h"
+#include "soci-exchange-cast.h"
 #include "soci-mktime.h"
 #include "soci-static-assert.h"
 #include <cctype>
@@ -155,6 +157,21 @@ void odbc_vector_into_type_backend::define_by_pos(
             data = buf_;
         }
         break;
+    case x_packedstrings:
+        {
+            odbcType_ = SQL_C_CHAR;
+            std::size_t const vsize
+                = exchange_type_cast<x_packedstrings>(data).size();
+            colSize_ = get_sqllen_from_value(statement_.column_size(position)) + 1;
+            std::size_t bufSize = colSize_ * vsize;
+            buf_ = new char[bufSize];
+
+            prepare_indicators(vsize);
+
+            size = static_cast<SQLINTEGER>(colSize_);
+            data = buf_;
+        }
+        break;
     case x_stdtm:
         {
             odbcType_ = SQL_C_TYPE_TIMESTAMP;
@@ -172,6 +189,41 @@ void odbc_vector_into_type_backend::define_by_pos(
             data = buf_;
         }
         break;
+    case x_timestamp:
+        {
+            odbcType_ = SQL_C_TYPE_TIMESTAMP;
+            std::vector<timestamp> *v
+                = static_cast<std::vector<timestamp> *>(data);
+
+            prepare_indicators(v->size());
+
+            size = sizeof(TIMESTAMP_STRUCT);
+            colSize_ = size;
+
+            std::size_t bufSize = size * v->size();
+
+            buf_ = new char[bufSize];
+            data = buf_;
+        }
+        break;
+    case x_decimal:
+        {
+            // see the comment in odbc_standard_into_type_backend
+            odbcType_ = SQL_C_CHAR;
+            std::vector<decimal> *v
+                = static_cast<std::vector<decimal> *>(data);
+
+            prepare_indicators(v->size());
+
+            size = max_decimal_length;
+            colSize_ = size;
+
+            std::size_t bufSize = size * v->size();
+
+            buf_ = new char[bufSize];
+            data = buf_;
+        }
+        break;
 
     default:
         throw soci_error("Into element used with non-supported type.");
@@ -214,15 +266,26 @@ void odbc_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                 pos += colSize_;
             }
         }
-        if (type_ == x_stdstring)
+        if (type_ == x_stdstring || type_ == x_packedstrings)
         {
-            std::vector<std::string> *vp
-                = static_cast<std::vector<std::string> *>(data_);
-
-            std::vector<std::string> &v(*vp);
+            // exactly one of these pointers is non-null
+            std::vector<std::string> *vp = NULL;
+            packed_strings *pp = NULL;
+            std::size_t vsize;
+            if (type_ == x_stdstring)
+            {
+                vp = static_cast<std::vector<std::string> *>(data_);
+                vsize = vp->size();
+            }
+            else
+            {
+                // all the values are appended to the buffer, start afresh
+                pp = &exchange_type_cast<x_packedstrings>(data_);
+                pp->reset();
+                vsize = pp->size();
+            }
 
             const char *pos = buf_;
-            std::size_t const vsize = v.size();
             for (std::size_t i = 0; i != vsize; ++i, pos += colSize_)
             {
                 SQLLEN const len = get_sqllen_from_vector_at(i);
@@ -230,7 +293,8 @@ void odbc_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                 if (len == -1)
                 {
                     // Value is null.
-                    v[i].clear();
+                    if (vp)
+                        (*vp)[i].clear();
                     continue;
                 }
 
@@ -256,7 +320,10 @@ void odbc_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                     }
                 }
 
-                v[i].assign(pos, end - pos);
+                if (vp)
+                    (*vp)[i].assign(pos, end - pos);
+                else
+                    pp->set(i, pos, end - pos);
             }
         }
         else if (type_ == x_stdtm)
@@ -276,6 +343,43 @@ void odbc_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                 pos += colSize_;
             }
         }
+        else if (type_ == x_timestamp)
+        {
+            std::vector<timestamp> *vp
+                = static_cast<std::vector<timestamp> *>(data_);
+
+            std::vector<timestamp> &v(*vp);
+            char *pos = buf_;
+            std::size_t const vsize = v.size();
+            for (std::size_t i = 0; i != vsize; ++i)
+            {
+                TIMESTAMP_STRUCT * ts = reinterpret_cast<TIMESTAMP_STRUCT*>(pos);
+
+                // ODBC fraction is in nanoseconds
+                v[i].microseconds =
+                    details::timestamp_from_ymdhms(ts->year, ts->month, ts->day,
+                                                   ts->hour, ts->minute, ts->second,
+                                                   ts->fraction / 1000);
+                pos += colSize_;
+            }
+        }
+        else if (type_ == x_decimal)
+        {
+            std::vector<decimal> *vp
+                = static_cast<std::vector<decimal> *>(data_);
+
+            std::vector<decimal> &v(*vp);
+            char *pos = buf_;
+            std::size_t const vsize = v.size();
+            for (std::size_t i = 0; i != vsize; ++i, pos += colSize_)
+            {
+                // the buffer doesn't contain anything for null values
+                if (get_sqllen_from_vector_at(i) == SQL_NULL_DATA)
+                    continue;
+
+                details::parse_decimal(pos, v[i]);
+            }
+        }
         else if (type_ == x_long_long && use_string_for_bigint())
         {
             std::vector<long long> *vp
@@ -410,6 +514,23 @@ void odbc_vector_into_type_backend::resize(std::size_t sz)
             v->resize(sz);
         }
         break;
+    case x_timestamp:
+        {
+            std::vector<timestamp> *v
+                = static_cast<std::vector<timestamp> *>(data_);
+            v->resize(sz);
+        }
+        break;
+    case x_decimal:
+        {
+            std::vector<decimal> *v
+                = static_cast<std::vector<decimal> *>(data_);
+            v->resize(sz);
+        }
+        break;
+    case x_packedstrings:
+        exchange_type_cast<x_packedstrings>(data_).resize(sz);
+        break;
 
     default:
         throw soci_error("Into vector element used with non-supported type.");
@@ -475,6 +596,23 @@ std::size_t odbc_vector_into_type_backend::size()
             sz = v->size();
         }
         break;
+    case x_timestamp:
+        {
+            std::vector<timestamp> *v
+                = static_cast<std::vector<timestamp> *>(data_);
+            sz = v->size();
+        }
+        break;
+    case x_decimal:
+        {
+            std::vector<decimal> *v
+                = static_cast<std::vector<decimal> *>(data_);
+            sz = v->size();
+        }
+        break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
 
     default:
         throw soci_error("Into vector element used with non-supported type.");
@@ -9,6 +9,9 @@
 #include "soci/soci-platform.h"
 #include "soci/odbc/soci-odbc.h"
 #include "soci-static-assert.h"
+#include "soci-decimal.h"
+#include "soci-exchange-cast.h"
+#include "soci-mktime.h"
 #include <cctype>
 #include <cstdio>
 #include <cstring>
@@ -186,6 +189,39 @@ void odbc_vector_use_type_backend::prepare_for_bind(void *&data, SQLUINTEGER &si
             size = static_cast<SQLINTEGER>(maxSize);
         }
         break;
+    case x_packedstrings:
+        {
+            sqlType = SQL_CHAR;
+            cType = SQL_C_CHAR;
+
+            packed_strings const &v = exchange_type_cast<x_packedstrings>(data);
+
+            std::size_t maxSize = 0;
+            std::size_t const vecSize = v.size();
+            prepare_indicators(vecSize);
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                std::size_t sz = v.length(i);
+                set_sqllen_from_vector_at(i, static_cast<long>(sz));
+                maxSize = sz > maxSize ? sz : maxSize;
+            }
+
+            maxSize++; // For terminating nul.
+
+            buf_ = new char[maxSize * vecSize];
+            memset(buf_, 0, maxSize * vecSize);
+
+            char *pos = buf_;
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                memcpy(pos, v.data(i), v.length(i));
+                pos += maxSize;
+            }
+
+            data = buf_;
+            size = static_cast<SQLINTEGER>(maxSize);
+        }
+        break;
     case x_stdtm:
         {
             std::vector<std::tm> *vp
@@ -203,6 +239,39 @@ void odbc_vector_use_type_backend::prepare_for_bind(void *&data, SQLUINTEGER &si
                       // yyyy-mm-dd hh:mm:ss
         }
         break;
+    case x_timestamp:
+        {
+            std::vector<timestamp> *vp
+                = static_cast<std::vector<timestamp> *>(data);
+
+            prepare_indicators(vp->size());
+
+            buf_ = new char[sizeof(TIMESTAMP_STRUCT) * vp->size()];
+
+            sqlType = SQL_TYPE_TIMESTAMP;
+            cType = SQL_C_TYPE_TIMESTAMP;
+            data = buf_;
+            size = 26; // yyyy-mm-dd hh:mm:ss.ffffff
+        }
+        break;
+    case x_decimal:
+        {
+            std::vector<decimal> *vp
+                = static_cast<std::vector<decimal> *>(data);
+
+            prepare_indicators(vp->size());
+
+            // As for single values, pass the exact text representation and
+            // let the database convert it, notably because the scale may be
+            // different for different elements.
+            size = decimal_buffer_size;
+            buf_ = new char[size * vp->size()];
+
+            sqlType = SQL_VARCHAR;
+            cType = SQL_C_CHAR;
+            data = buf_;
+        }
+        break;
 
     // not supported
     default:
@@ -226,8 +295,11 @@ void odbc_vector_use_type_backend::bind_helper(int &position, void *data, exchan
     SQLULEN const arraySize = static_cast<SQLULEN>(indHolderVec_.size());
     SQLSetStmtAttr(statement_.hstmt_, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)arraySize, 0);
 
+    // only timestamps need the digits of fractional seconds
+    SQLSMALLINT const decimalDigits = type_ == x_timestamp ? 6 : 0;
+
     SQLRETURN rc = SQLBindParameter(statement_.hstmt_, static_cast<SQLUSMALLINT>(position++),
-                                    SQL_PARAM_INPUT, cType, sqlType, size, 0,
+                                    SQL_PARAM_INPUT, cType, sqlType, size, decimalDigits,
                                     static_cast<SQLPOINTER>(data), size, indHolders_);
 
     if (is_odbc_error(rc))
@@ -303,6 +375,7 @@ void odbc_vector_use_type_backend::pre_use(indicator const *ind)
 
         case x_char:
         case x_stdstring:
+        case x_packedstrings:
             non_null_indicator = SQL_NTS;
             break;
 
@@ -332,6 +405,55 @@ void odbc_vector_use_type_backend::pre_use(indicator const *ind)
             }
             break;
 
+        case x_timestamp:
+            {
+                std::vector<timestamp> *vp
+                     = static_cast<std::vector<timestamp> *>(data_);
+
+                std::vector<timestamp> &v(*vp);
+
+                char *pos = buf_;
+                std::size_t const vsize = v.size();
+                for (std::size_t i = 0; i != vsize; ++i)
+                {
+                    int year, month, day, hour, minute, second, microsecond;
+                    timestamp_to_ymdhms(v[i].microseconds,
+                                        year, month, day,
+                                        hour, minute, second, microsecond);
+
+                    TIMESTAMP_STRUCT * ts = reinterpret_cast<TIMESTAMP_STRUCT*>(pos);
+
+                    ts->year = static_cast<SQLSMALLINT>(year);
+                    ts->month = static_cast<SQLUSMALLINT>(month);
+                    ts->day = static_cast<SQLUSMALLINT>(day);
+                    ts->hour = static_cast<SQLUSMALLINT>(hour);
+                    ts->minute = static_cast<SQLUSMALLINT>(minute);
+                    ts->second = static_cast<SQLUSMALLINT>(second);
+                    ts->fraction = static_cast<SQLUINTEGER>(microsecond) * 1000;
+                    pos += sizeof(TIMESTAMP_STRUCT);
+                }
+            }
+            break;
+
+        case x_decimal:
+            {
+                std::vector<decimal> *vp
+                     = static_cast<std::vector<decimal> *>(data_);
+
+                std::vector<decimal> &v(*vp);
+
+                char *pos = buf_;
+                std::size_t const vsize = v.size();
+                for (std::size_t i = 0; i != vsize; ++i)
+                {
+                    format_decimal(pos, v[i]);
+                    pos += decimal_buffer_size;
+                }
+
+                non_null_indicator = SQL_NTS;
+            }
+            break;
+
         case x_long_long:
             if (use_string_for_bigint())
             {
@@ -375,6 +497,7 @@ void odbc_vector_use_type_backend::pre_use(indicator const *ind)
         case x_blob:
         case x_xmltype:
         case x_longstring:
+        case x_stringref:
             // Those are unreachable, we would have thrown from
             // prepare_for_bind() if we we were using one of them, only handle
             // them here to avoid compiler warnings about unhandled enum
@@ -395,7 +518,7 @@ void odbc_vector_use_type_backend::pre_use(indicator const *ind)
             else
             {
                 // for strings we have already set the values
-                if (type_ != x_stdstring)
+                if (type_ != x_stdstring && type_ != x_packedstrings)
                 {
                     set_sqllen_from_vector_at(i, non_null_indicator);
                 }
@@ -409,7 +532,7 @@ void odbc_vector_use_type_backend::pre_use(indicator const *ind)
         for (std::size_t i = 0; i != vsize; ++i, ++ind)
         {
             // for strings we have already set the values
-            if (type_ != x_stdstring)
+            if (type_ != x_stdstring && type_ != x_packedstrings)
             {
                 set_sqllen_from_vector_at(i, non_null_indicator);
             }
@@ -476,6 +599,23 @@ std::size_t odbc_vector_use_type_backend::size()
             sz = vp->size();
         }
         break;
+    case x_timestamp:
+        {
+            std::vector<timestamp> *vp
+                = static_cast<std::vector<timestamp> *>(data_);
+            sz = vp->size();
+        }
+        break;
+    case x_decimal:
+        {
+            std::vector<decimal> *vp
+                = static_cast<std::vector<decimal> *>(data_);
+            sz = vp->size();
+        }
+        break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
 
     // not supported
     default:
@@ -105,12 +105,30 @@ int charset_code(const std::string & name)
     return code;
 }
 
+// decode non-negative numeric option value
+unsigned size_value(std::string const & value, char const * name)
+{
+    std::istringstream ss(value);
+
+    unsigned size;
+    ss >> size;
+    if (!ss || value.find('-') != std::string::npos)
+    {
+        throw soci_error(std::string("Invalid ") + name + ".");
+    }
+
+    return size;
+}
+
 // retrieves service name, user name and password from the
 // uniform connect string
 void chop_connect_string(std::string const & connectString,
     std::string & serviceName, std::string & userName,
     std::string & password, int & mode, bool & decimals_as_strings,
-    int & charset, int & ncharset)
+    int & charset, int & ncharset, unsigned & stmt_cache_size,
+    unsigned & session_pool_size, unsigned & prefetch_rows,
+    unsigned & prefetch_memory, unsigned & lob_prefetch_size,
+    bool & batch_errors)
 {
     serviceName.clear();
     userName.clear();
@@ -119,6 +137,12 @@ void chop_connect_string(std::string const & connectString,
     decimals_as_strings = false;
     charset = 0;
     ncharset = 0;
+    stmt_cache_size = 0;
+    session_pool_size = 0;
+    prefetch_rows = 0;
+    prefetch_memory = 0;
+    lob_prefetch_size = 0;
+    batch_errors = false;
 
     std::string key, value;
     std::string::const_iterator i = connectString.begin();
@@ -168,6 +192,30 @@ void chop_connect_string(std::string const & connectString,
         {
             ncharset = charset_code(value);
         }
+        else if (key == "stmt_cache_size")
+        {
+            stmt_cache_size = size_value(value, "statement cache size");
+        }
+        else if (key == "session_pool")
+        {
+            session_pool_size = size_value(value, "session pool size");
+        }
+        else if (key == "prefetch_rows")
+        {
+            prefetch_rows = size_value(value, "number of prefetched rows");
+        }
+        else if (key == "prefetch_memory")
+        {
+            prefetch_memory = size_value(value, "prefetch memory size");
+        }
+        else if (key == "lob_prefetch_size")
+        {
+            lob_prefetch_size = size_value(value, "LOB prefetch size");
+        }
+        else if (key == "batch_errors")
+        {
+            batch_errors = value == "1" || value == "Y" || value == "y";
+        }
     }
 }
 
@@ -180,12 +228,28 @@ oracle_session_backend * oracle_backend_factory::make_session(
     bool decimals_as_strings;
     int charset;
     int ncharset;
+    unsigned stmt_cache_size;
+    unsigned session_pool_size;
+    unsigned prefetch_rows;
+    unsigned prefetch_memory;
+    unsigned lob_prefetch_size;
+    bool batch_errors;
 
     chop_connect_string(parameters.get_connect_string(), serviceName, userName, password,
-        mode, decimals_as_strings, charset, ncharset);
+        mode, decimals_as_strings, charset, ncharset,
+        stmt_cache_size, session_pool_size,
+        prefetch_rows, prefetch_memory, lob_prefetch_size, batch_errors);
+
+    oracle_session_backend * backend = new oracle_session_backend(serviceName,
+        userName, password, mode, decimals_as_strings, charset, ncharset,
+        stmt_cache_size, session_pool_size);
+
+    backend->prefetchRows_ = prefetch_rows;
+    backend->prefetchMemory_ = prefetch_memory;
+    backend->lobPrefetchSize_ = lob_prefetch_size;
+    backend->useBatchErrors_ = batch_errors;
 
-    return new oracle_session_backend(serviceName, userName, password,
-        mode, decimals_as_strings, charset, ncharset);
+    return backend;
 }
 
 oracle_backend_factory const soci::oracle;
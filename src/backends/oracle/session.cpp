@@ -9,10 +9,12 @@
 #include "soci/oracle/soci-oracle.h"
 #include "soci/callbacks.h"
 #include "error.h"
+#include "soci-thread.h"
 #include <cctype>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
+#include <map>
 #include <sstream>
 
 #ifdef _MSC_VER
@@ -119,14 +121,210 @@ sb4 fo_callback(void * /* svchp */, void * /* envhp */, void * fo_ctx,
     return 0;
 }
 
+// converts the string from UTF-8 to the given charset, if any
+std::string nls_convert(OCIEnv * envhp, OCIError * errhp, int charset,
+    std::string const & str)
+{
+    if (charset == 0 || str.empty())
+    {
+        return str;
+    }
+
+    // assume the string is utf8-compatible already
+    const int defaultSourceCharSetId = 871;
+
+    // a character can't take more than 4 bytes in any supported charset
+    std::vector<char> buf(4 * str.size());
+    size_t len;
+
+    sword res = OCINlsCharSetConvert(envhp, errhp,
+        charset, &buf[0], buf.size(),
+        defaultSourceCharSetId, str.c_str(), str.size(), &len);
+    if (res != OCI_SUCCESS)
+    {
+        throw_oracle_soci_error(res, errhp);
+    }
+
+    return std::string(&buf[0], len);
+}
+
+// OCI session pool shared by all sessions using the same parameters.
+struct session_pool
+{
+    session_pool()
+        : envhp_(NULL), errhp_(NULL), spoolhp_(NULL), name_(NULL), nameLen_(0)
+    {}
+
+    void create(std::string const & serviceName,
+        std::string const & userName, std::string const & password,
+        int charset, int ncharset, unsigned sessionPoolSize);
+
+    void destroy()
+    {
+        if (spoolhp_ != NULL)
+        {
+            if (name_ != NULL)
+            {
+                OCISessionPoolDestroy(spoolhp_, errhp_, OCI_SPD_FORCE);
+            }
+
+            OCIHandleFree(spoolhp_, OCI_HTYPE_SPOOL);
+        }
+
+        if (errhp_) { OCIHandleFree(errhp_, OCI_HTYPE_ERROR); }
+        if (envhp_) { OCIHandleFree(envhp_, OCI_HTYPE_ENV);   }
+
+        *this = session_pool();
+    }
+
+    OCIEnv *envhp_;
+    OCIError *errhp_;
+    OCISPool *spoolhp_;
+    OraText *name_;
+    ub4 nameLen_;
+};
+
+void session_pool::create(std::string const & serviceName,
+    std::string const & userName, std::string const & password,
+    int charset, int ncharset, unsigned sessionPoolSize)
+{
+    // the environment is shared by the sessions used from different
+    // threads, so it must use mutexes, unlike the standalone sessions ones
+    sword res = OCIEnvNlsCreate(&envhp_, OCI_THREADED,
+        0, 0, 0, 0, 0, 0, charset, ncharset);
+    if (res != OCI_SUCCESS)
+    {
+        envhp_ = NULL;
+        throw soci_error("Cannot create environment");
+    }
+
+    res = OCIHandleAlloc(envhp_, reinterpret_cast<dvoid**>(&errhp_),
+        OCI_HTYPE_ERROR, 0, 0);
+    if (res != OCI_SUCCESS)
+    {
+        destroy();
+        throw soci_error("Cannot create error handle");
+    }
+
+    res = OCIHandleAlloc(envhp_, reinterpret_cast<dvoid**>(&spoolhp_),
+        OCI_HTYPE_SPOOL, 0, 0);
+    if (res != OCI_SUCCESS)
+    {
+        destroy();
+        throw soci_error("Cannot create session pool handle");
+    }
+
+    try
+    {
+        std::string const service = nls_convert(envhp_, errhp_, charset,
+            serviceName);
+        std::string const user = nls_convert(envhp_, errhp_, charset,
+            userName);
+        std::string const pass = nls_convert(envhp_, errhp_, charset,
+            password);
+
+        // all sessions use the same credentials unless external ones are
+        // used, see get_pooled_session()
+        ub4 poolMode = OCI_DEFAULT;
+        if (userName.empty() == false || password.empty() == false)
+        {
+            poolMode |= OCI_SPC_HOMOGENEOUS;
+        }
+
+        // sessions are created on demand and kept open up to the pool size
+        res = OCISessionPoolCreate(envhp_, errhp_, spoolhp_,
+            &name_, &nameLen_,
+            reinterpret_cast<OraText*>(const_cast<char*>(service.c_str())),
+            static_cast<ub4>(service.size()),
+            0, sessionPoolSize, 1,
+            reinterpret_cast<OraText*>(const_cast<char*>(user.c_str())),
+            static_cast<ub4>(user.size()),
+            reinterpret_cast<OraText*>(const_cast<char*>(pass.c_str())),
+            static_cast<ub4>(pass.size()),
+            poolMode);
+        if (res != OCI_SUCCESS && res != OCI_SUCCESS_WITH_INFO)
+        {
+            name_ = NULL;
+            throw_oracle_soci_error(res, errhp_);
+        }
+    }
+    catch (...)
+    {
+        destroy();
+        throw;
+    }
+}
+
+// All the session pools ever created, they are kept alive until the
+// program termination to allow reusing their sessions after closing all
+// SOCI sessions using them.
+class session_pools
+{
+public:
+    ~session_pools()
+    {
+        for (pools_map::iterator it = pools_.begin(); it != pools_.end(); ++it)
+        {
+            it->second.destroy();
+        }
+    }
+
+    session_pool const & get(std::string const & serviceName,
+        std::string const & userName, std::string const & password,
+        int charset, int ncharset, unsigned sessionPoolSize)
+    {
+        std::ostringstream key;
+        key << serviceName << '\0' << userName << '\0' << password << '\0'
+            << charset << ' ' << ncharset << ' ' << sessionPoolSize;
+
+        scoped_lock lock(mtx_);
+
+        session_pool & pool = pools_[key.str()];
+        if (pool.spoolhp_ == NULL)
+        {
+            try
+            {
+                pool.create(serviceName, userName, password,
+                    charset, ncharset, sessionPoolSize);
+            }
+            catch (...)
+            {
+                pools_.erase(key.str());
+                throw;
+            }
+        }
+
+        return pool;
+    }
+
+private:
+    typedef std::map<std::string, session_pool> pools_map;
+
+    mutex mtx_;
+    pools_map pools_;
+};
+
+session_pools sessionPools;
+
 } // unnamed namespace
 
 oracle_session_backend::oracle_session_backend(std::string const & serviceName,
     std::string const & userName, std::string const & password, int mode,
-    bool decimals_as_strings, int charset, int ncharset)
+    bool decimals_as_strings, int charset, int ncharset,
+    unsigned stmt_cache_size, unsigned session_pool_size)
     : envhp_(NULL), srvhp_(NULL), errhp_(NULL), svchp_(NULL), usrhp_(NULL),
-      decimals_as_strings_(decimals_as_strings)
+      decimals_as_strings_(decimals_as_strings),
+      stmtCacheSize_(stmt_cache_size), pooled_(false),
+      prefetchRows_(0), prefetchMemory_(0), lobPrefetchSize_(0),
+      useBatchErrors_(false)
 {
+    if (session_pool_size != 0)
+    {
+        get_pooled_session(serviceName, userName, password, mode,
+            charset, ncharset, session_pool_size);
+        return;
+    }
+
     // assume service/user/password are utf8-compatible already
     const int defaultSourceCharSetId = 871;
 
@@ -332,6 +530,12 @@ oracle_session_backend::oracle_session_backend(std::string const & serviceName,
         }
     }
 
+    // enable statement caching if requested, its size is set below
+    if (stmtCacheSize_ != 0)
+    {
+        mode |= OCI_STMT_CACHE;
+    }
+
     // begin the session
     res = OCISessionBegin(svchp_, errhp_, usrhp_,
         credentialType, mode);
@@ -355,6 +559,80 @@ oracle_session_backend::oracle_session_backend(std::string const & serviceName,
         clean_up();
         throw oracle_soci_error(msg, errNum);
     }
+
+    set_statement_cache_size();
+}
+
+void oracle_session_backend::get_pooled_session(
+    std::string const & serviceName, std::string const & userName,
+    std::string const & password, int mode, int charset, int ncharset,
+    unsigned sessionPoolSize)
+{
+    if (mode != OCI_DEFAULT)
+    {
+        throw soci_error("Connection mode can't be used with a session pool.");
+    }
+
+    session_pool const & pool = sessionPools.get(serviceName,
+        userName, password, charset, ncharset, sessionPoolSize);
+
+    // the environment belongs to the pool and is not freed by clean_up()
+    envhp_ = pool.envhp_;
+    pooled_ = true;
+
+    sword res = OCIHandleAlloc(envhp_, reinterpret_cast<dvoid**>(&errhp_),
+        OCI_HTYPE_ERROR, 0, 0);
+    if (res != OCI_SUCCESS)
+    {
+        errhp_ = NULL;
+        clean_up();
+        throw soci_error("Cannot create error handle");
+    }
+
+    ub4 getMode = OCI_SESSGET_SPOOL;
+    if (userName.empty() && password.empty())
+    {
+        getMode |= OCI_SESSGET_CREDEXT;
+    }
+    if (stmtCacheSize_ != 0)
+    {
+        getMode |= OCI_SESSGET_STMTCACHE;
+    }
+
+    // this reuses an idle session of the pool if there is one
+    res = OCISessionGet(envhp_, errhp_, &svchp_, NULL,
+        pool.name_, pool.nameLen_, NULL, 0, NULL, NULL, NULL, getMode);
+    if (res != OCI_SUCCESS && res != OCI_SUCCESS_WITH_INFO)
+    {
+        std::string msg;
+        int errNum;
+        get_error_details(res, errhp_, msg, errNum);
+        svchp_ = NULL;
+        clean_up();
+        throw oracle_soci_error(msg, errNum);
+    }
+
+    set_statement_cache_size();
+}
+
+void oracle_session_backend::set_statement_cache_size()
+{
+    if (stmtCacheSize_ == 0)
+    {
+        return;
+    }
+
+    ub4 size = stmtCacheSize_;
+    sword res = OCIAttrSet(svchp_, OCI_HTYPE_SVCCTX, &size,
+        0, OCI_ATTR_STMTCACHESIZE, errhp_);
+    if (res != OCI_SUCCESS)
+    {
+        std::string msg;
+        int errNum;
+        get_error_details(res, errhp_, msg, errNum);
+        clean_up();
+        throw oracle_soci_error(msg, errNum);
+    }
 }
 
 oracle_session_backend::~oracle_session_backend()
@@ -394,6 +672,25 @@ void oracle_session_backend::rollback()
 
 void oracle_session_backend::clean_up()
 {
+    if (pooled_)
+    {
+        // return the session to the pool instead of ending it
+        if (svchp_ != NULL)
+        {
+            OCISessionRelease(svchp_, errhp_, NULL, 0, OCI_DEFAULT);
+            svchp_ = NULL;
+        }
+
+        if (errhp_)
+        {
+            OCIHandleFree(errhp_, OCI_HTYPE_ERROR);
+            errhp_ = NULL;
+        }
+
+        envhp_ = NULL;
+        return;
+    }
+
     if (svchp_ != NULL && errhp_ != NULL && usrhp_ != NULL)
     {
         OCISessionEnd(svchp_, errhp_, usrhp_, OCI_DEFAULT);
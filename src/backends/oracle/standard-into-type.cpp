@@ -91,6 +91,7 @@ void oracle_standard_into_type_backend::define_by_pos(
         data = buf_;
         break;
     case x_stdstring:
+    case x_stringref:
         oracleType = SQLT_STR;
         size = 32769;  // support selecting strings from LONG columns
         buf_ = new char[size];
@@ -160,6 +161,11 @@ void oracle_standard_into_type_backend::define_by_pos(
             ociData_ = lobp;
         }
         break;
+
+    case x_packedstrings:
+    case x_timestamp:
+    case x_decimal:
+        throw soci_error("Into element used with non-supported type.");
     }
 
     sword res = OCIDefineByPos(statement_.stmtp_, &defnp_,
@@ -171,6 +177,40 @@ void oracle_standard_into_type_backend::define_by_pos(
     {
         throw_oracle_soci_error(res, statement_.session_.errhp_);
     }
+
+    if (oracleType == SQLT_BLOB || oracleType == SQLT_CLOB)
+    {
+        set_lob_prefetch();
+    }
+}
+
+void oracle_standard_into_type_backend::set_lob_prefetch()
+{
+    // LOB prefetching is only available since Oracle 11.1, just ignore the
+    // option when using the older client
+#ifdef OCI_ATTR_LOBPREFETCH_SIZE
+    ub4 size = statement_.lobPrefetchSize_;
+    if (size == 0)
+    {
+        return;
+    }
+
+    sword res = OCIAttrSet(defnp_, OCI_HTYPE_DEFINE, &size, 0,
+        OCI_ATTR_LOBPREFETCH_SIZE, statement_.session_.errhp_);
+    if (res != OCI_SUCCESS)
+    {
+        throw_oracle_soci_error(res, statement_.session_.errhp_);
+    }
+
+    // also prefetch the length to avoid a round trip in OCILobGetLength()
+    boolean prefetchLength = TRUE;
+    res = OCIAttrSet(defnp_, OCI_HTYPE_DEFINE, &prefetchLength, 0,
+        OCI_ATTR_LOBPREFETCH_LENGTH, statement_.session_.errhp_);
+    if (res != OCI_SUCCESS)
+    {
+        throw_oracle_soci_error(res, statement_.session_.errhp_);
+    }
+#endif // OCI_ATTR_LOBPREFETCH_SIZE
 }
 
 void oracle_standard_into_type_backend::pre_exec(int /* num */)
@@ -255,6 +295,16 @@ void oracle_standard_into_type_backend::post_fetch(
                 exchange_type_cast<x_stdstring>(data_) = buf_;
             }
         }
+        else if (type_ == x_stringref)
+        {
+            if (indOCIHolder_ != -1)
+            {
+                // the data remains valid until the next fetch overwrites buf_
+                string_ref& ref = exchange_type_cast<x_stringref>(data_);
+                ref.data = buf_;
+                ref.length = std::strlen(buf_);
+            }
+        }
         else if (type_ == x_long_long)
         {
             if (indOCIHolder_ != -1)
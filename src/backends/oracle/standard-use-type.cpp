@@ -88,6 +88,7 @@ void oracle_standard_use_type_backend::prepare_for_bind(
         data = buf_;
         break;
     case x_stdstring:
+    case x_stringref:
         oracleType = SQLT_STR;
         // 4000 is Oracle max VARCHAR2 size; 32768 is max LONG size
         size = 32769;
@@ -158,6 +159,11 @@ void oracle_standard_use_type_backend::prepare_for_bind(
             ociData_ = lobp;
         }
         break;
+
+    case x_packedstrings:
+    case x_timestamp:
+    case x_decimal:
+        throw soci_error("Use element used with non-supported type.");
     }
 }
 
@@ -367,6 +373,20 @@ void oracle_standard_use_type_backend::pre_use(indicator const *ind)
             buf_[toCopy] = '\0';
         }
         break;
+    case x_stringref:
+        {
+            string_ref const& s = exchange_type_cast<x_stringref>(data_);
+
+            std::size_t const bufSize = 32769;
+            std::size_t const toCopy =
+                s.length < bufSize - 1 ? s.length : bufSize - 1;
+            if (toCopy != 0)
+            {
+                std::memcpy(buf_, s.data, toCopy);
+            }
+            buf_[toCopy] = '\0';
+        }
+        break;
     case x_stdtm:
         {
             std::tm const& t = exchange_type_cast<x_stdtm>(data_);
@@ -393,6 +413,9 @@ void oracle_standard_use_type_backend::pre_use(indicator const *ind)
     case x_longstring:
     case x_rowid:
     case x_blob:
+    case x_packedstrings:
+    case x_timestamp:
+    case x_decimal:
         // nothing to do
         break;
     }
@@ -559,6 +582,10 @@ void oracle_standard_use_type_backend::post_use(bool gotData, indicator *ind)
         case x_blob:
         case x_xmltype:
         case x_longstring:
+        case x_stringref:
+        case x_packedstrings:
+        case x_timestamp:
+        case x_decimal:
             // nothing to do here
             break;
         }
@@ -27,7 +27,11 @@ using namespace soci::details::oracle;
 
 oracle_statement_backend::oracle_statement_backend(oracle_session_backend &session)
     : session_(session), stmtp_(NULL), boundByName_(false), boundByPos_(false),
-      noData_(false)
+      noData_(false), cached_(false),
+      prefetchRows_(session.prefetchRows_),
+      prefetchMemory_(session.prefetchMemory_),
+      lobPrefetchSize_(session.lobPrefetchSize_),
+      useBatchErrors_(session.useBatchErrors_)
 {
 }
 
@@ -42,14 +46,95 @@ void oracle_statement_backend::alloc()
     }
 }
 
-void oracle_statement_backend::clean_up()
+void oracle_statement_backend::free_handle()
 {
-    // deallocate statement handle
     if (stmtp_ != NULL)
     {
-        OCIHandleFree(stmtp_, OCI_HTYPE_STMT);
+        if (cached_)
+        {
+            // return the statement to the cache for reuse
+            OCIStmtRelease(stmtp_, session_.errhp_, NULL, 0, OCI_DEFAULT);
+            cached_ = false;
+        }
+        else
+        {
+            OCIHandleFree(stmtp_, OCI_HTYPE_STMT);
+        }
+
         stmtp_ = NULL;
     }
+}
+
+void oracle_statement_backend::set_prefetch_attribute(ub4 attr, ub4 value)
+{
+    sword res = OCIAttrSet(stmtp_, OCI_HTYPE_STMT, &value, 0, attr,
+        session_.errhp_);
+    if (res != OCI_SUCCESS)
+    {
+        throw_oracle_soci_error(res, session_.errhp_);
+    }
+}
+
+void oracle_statement_backend::collect_batch_errors()
+{
+    ub4 count = 0;
+    sword res = OCIAttrGet(stmtp_, OCI_HTYPE_STMT, &count, 0,
+        OCI_ATTR_NUM_DML_ERRORS, session_.errhp_);
+    if (res != OCI_SUCCESS)
+    {
+        throw_oracle_soci_error(res, session_.errhp_);
+    }
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    // the errors for the individual rows are retrieved using a separate
+    // error handle
+    OCIError * rowErrhp = NULL;
+    res = OCIHandleAlloc(session_.envhp_, reinterpret_cast<dvoid**>(&rowErrhp),
+        OCI_HTYPE_ERROR, 0, 0);
+    if (res != OCI_SUCCESS)
+    {
+        throw soci_error("Cannot create error handle");
+    }
+
+    batchErrors_.resize(count);
+    for (ub4 i = 0; i != count; ++i)
+    {
+        res = OCIParamGet(session_.errhp_, OCI_HTYPE_ERROR,
+            session_.errhp_, reinterpret_cast<dvoid**>(&rowErrhp), i);
+        if (res == OCI_SUCCESS)
+        {
+            ub4 rowOffset = 0;
+            res = OCIAttrGet(rowErrhp, OCI_HTYPE_ERROR, &rowOffset, 0,
+                OCI_ATTR_DML_ROW_OFFSET, session_.errhp_);
+            if (res == OCI_SUCCESS)
+            {
+                oracle_batch_error & error = batchErrors_[i];
+                error.row_ = rowOffset;
+                get_error_details(OCI_ERROR, rowErrhp,
+                    error.message_, error.err_num_);
+                continue;
+            }
+        }
+
+        std::string msg;
+        int errNum;
+        get_error_details(res, session_.errhp_, msg, errNum);
+        batchErrors_.clear();
+        OCIHandleFree(rowErrhp, OCI_HTYPE_ERROR);
+        throw oracle_soci_error(msg, errNum);
+    }
+
+    OCIHandleFree(rowErrhp, OCI_HTYPE_ERROR);
+}
+
+void oracle_statement_backend::clean_up()
+{
+    // deallocate statement handle
+    free_handle();
 
     boundByName_ = false;
     boundByPos_ = false;
@@ -58,6 +143,28 @@ void oracle_statement_backend::clean_up()
 void oracle_statement_backend::prepare(std::string const &query,
     statement_type /* eType */)
 {
+    if (session_.stmtCacheSize_ != 0)
+    {
+        // the handle allocated by alloc() is not needed as the cached one
+        // is returned, avoiding parsing the query again if it was already
+        // prepared in this session
+        free_handle();
+
+        sword res = OCIStmtPrepare2(session_.svchp_, &stmtp_,
+            session_.errhp_,
+            reinterpret_cast<text*>(const_cast<char*>(query.c_str())),
+            static_cast<ub4>(query.size()), NULL, 0,
+            OCI_NTV_SYNTAX, OCI_DEFAULT);
+        if (res != OCI_SUCCESS && res != OCI_SUCCESS_WITH_INFO)
+        {
+            stmtp_ = NULL;
+            throw_oracle_soci_error(res, session_.errhp_);
+        }
+
+        cached_ = true;
+        return;
+    }
+
     sb4 stmtLen = static_cast<sb4>(query.size());
     sword res = OCIStmtPrepare(stmtp_,
         session_.errhp_,
@@ -71,11 +178,47 @@ void oracle_statement_backend::prepare(std::string const &query,
 
 statement_backend::exec_fetch_result oracle_statement_backend::execute(int number)
 {
+    // prefetch options are only set if they were explicitly specified, so
+    // that OCI defaults are used otherwise
+    if (prefetchRows_ != 0)
+    {
+        set_prefetch_attribute(OCI_ATTR_PREFETCH_ROWS, prefetchRows_);
+    }
+    if (prefetchMemory_ != 0)
+    {
+        set_prefetch_attribute(OCI_ATTR_PREFETCH_MEMORY, prefetchMemory_);
+    }
+
+    batchErrors_.clear();
+
+    // batch errors mode only makes sense for array DML statements
+    ub4 mode = OCI_DEFAULT;
+    if (useBatchErrors_ && number > 1)
+    {
+        ub2 stmtType = 0;
+        sword res = OCIAttrGet(stmtp_, OCI_HTYPE_STMT, &stmtType, 0,
+            OCI_ATTR_STMT_TYPE, session_.errhp_);
+        if (res != OCI_SUCCESS)
+        {
+            throw_oracle_soci_error(res, session_.errhp_);
+        }
+
+        if (stmtType != OCI_STMT_SELECT)
+        {
+            mode = OCI_BATCH_ERRORS;
+        }
+    }
+
     sword res = OCIStmtExecute(session_.svchp_, stmtp_, session_.errhp_,
-        static_cast<ub4>(number), 0, 0, 0, OCI_DEFAULT);
+        static_cast<ub4>(number), 0, 0, 0, mode);
 
     if (res == OCI_SUCCESS || res == OCI_SUCCESS_WITH_INFO)
     {
+        if (mode == OCI_BATCH_ERRORS)
+        {
+            collect_batch_errors();
+        }
+
         noData_ = false;
         return ef_success;
     }
@@ -86,8 +229,21 @@ statement_backend::exec_fetch_result oracle_statement_backend::execute(int numbe
     }
     else
     {
-        throw_oracle_soci_error(res, session_.errhp_);
-        return ef_no_data; // unreachable dummy return to please the compiler
+        std::string msg;
+        int errNum;
+        get_error_details(res, session_.errhp_, msg, errNum);
+
+        // ORA-24381: error(s) in array DML, i.e. only some rows failed and
+        // the errors for them are reported by get_batch_errors()
+        if (mode == OCI_BATCH_ERRORS && errNum == 24381)
+        {
+            collect_batch_errors();
+
+            noData_ = false;
+            return ef_success;
+        }
+
+        throw oracle_soci_error(msg, errNum);
     }
 }
 
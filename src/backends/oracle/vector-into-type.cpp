@@ -10,6 +10,7 @@
 #include "soci/statement.h"
 #include "error.h"
 #include "soci/soci-platform.h"
+#include "soci-exchange-cast.h"
 #include "soci-mktime.h"
 #include <cctype>
 #include <cstdio>
@@ -130,6 +131,7 @@ void oracle_vector_into_type_backend::define_by_pos_bulk(
         }
         break;
     case x_stdstring:
+    case x_packedstrings:
         {
             oracleType = SQLT_CHR;
             const std::size_t vecSize = size();
@@ -160,6 +162,9 @@ void oracle_vector_into_type_backend::define_by_pos_bulk(
 
     case x_xmltype:
     case x_longstring:
+    case x_stringref:
+    case x_timestamp:
+    case x_decimal:
     case x_statement:
     case x_rowid:
     case x_blob:
@@ -206,6 +211,24 @@ void oracle_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
                 pos += colSize_;
             }
         }
+        else if (type_ == x_packedstrings)
+        {
+            packed_strings &v = exchange_type_cast<x_packedstrings>(data_);
+
+            // all the values are appended to the buffer, start afresh
+            v.reset();
+
+            char *pos = buf_;
+            std::size_t const vecSize = size();
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                if (indOCIHolderVec_[i] != -1)
+                {
+                    v.set(begin_ + i, pos, sizes_[i]);
+                }
+                pos += colSize_;
+            }
+        }
         else if (type_ == x_long_long)
         {
             std::vector<long long> *vp
@@ -385,6 +408,12 @@ void oracle_vector_into_type_backend::resize(std::size_t sz)
 
         case x_xmltype:    break; // not supported
         case x_longstring: break; // not supported
+        case x_stringref:  break; // not supported
+        case x_packedstrings:
+            exchange_type_cast<x_packedstrings>(data_).resize(sz);
+            break;
+        case x_timestamp: break; // not supported
+        case x_decimal: break; // not supported
         case x_statement:  break; // not supported
         case x_rowid:      break; // not supported
         case x_blob:       break; // not supported
@@ -480,6 +509,12 @@ std::size_t oracle_vector_into_type_backend::full_size()
 
     case x_xmltype:    break; // not supported
     case x_longstring: break; // not supported
+    case x_stringref:  break; // not supported
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
+    case x_timestamp: break; // not supported
+    case x_decimal: break; // not supported
     case x_statement:  break; // not supported
     case x_rowid:      break; // not supported
     case x_blob:       break; // not supported
@@ -9,6 +9,7 @@
 #include "soci/oracle/soci-oracle.h"
 #include "error.h"
 #include "soci/soci-platform.h"
+#include "soci-exchange-cast.h"
 #include <cctype>
 #include <cstdio>
 #include <cstring>
@@ -141,6 +142,33 @@ void oracle_vector_use_type_backend::prepare_for_bind(
             elementSize = static_cast<sb4>(maxSize);
         }
         break;
+    case x_packedstrings:
+        {
+            packed_strings const &v = exchange_type_cast<x_packedstrings>(data_);
+
+            std::size_t maxSize = 0;
+            std::size_t const vecSize = size();
+            prepare_indicators(vecSize);
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                std::size_t sz = v.length(begin_ + i);
+                sizes_.push_back(static_cast<ub2>(sz));
+                maxSize = sz > maxSize ? sz : maxSize;
+            }
+
+            buf_ = new char[maxSize * vecSize];
+            char *pos = buf_;
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                memcpy(pos, v.data(begin_ + i), v.length(begin_ + i));
+                pos += maxSize;
+            }
+
+            oracleType = SQLT_CHR;
+            data = buf_;
+            elementSize = static_cast<sb4>(maxSize);
+        }
+        break;
     case x_stdtm:
         {
             std::size_t const vecSize = size();
@@ -157,6 +185,9 @@ void oracle_vector_use_type_backend::prepare_for_bind(
 
     case x_xmltype:    break; // not supported
     case x_longstring: break; // not supported
+    case x_stringref:  break; // not supported
+    case x_timestamp: break; // not supported
+    case x_decimal: break; // not supported
     case x_statement:  break; // not supported
     case x_rowid:      break; // not supported
     case x_blob:       break; // not supported
@@ -180,8 +211,8 @@ void oracle_vector_use_type_backend::bind_by_pos_bulk(int & position,
 
     prepare_for_bind(dataBuf, elementSize, oracleType);
 
-    ub2 *sizesP = 0; // used only for std::string
-    if (type == x_stdstring)
+    ub2 *sizesP = 0; // used only for strings
+    if (type == x_stdstring || type == x_packedstrings)
     {
         sizesP = &sizes_[0];
     }
@@ -213,8 +244,8 @@ void oracle_vector_use_type_backend::bind_by_name_bulk(
 
     prepare_for_bind(dataBuf, elementSize, oracleType);
 
-    ub2 *sizesP = 0; // used only for std::string
-    if (type == x_stdstring)
+    ub2 *sizesP = 0; // used only for strings
+    if (type == x_stdstring || type == x_packedstrings)
     {
         sizesP = &sizes_[0];
     }
@@ -234,7 +265,7 @@ void oracle_vector_use_type_backend::bind_by_name_bulk(
 void oracle_vector_use_type_backend::pre_use(indicator const *ind)
 {
     // first deal with data
-    if (type_ == x_stdstring)
+    if (type_ == x_stdstring || type_ == x_packedstrings)
     {
         // nothing to do - it's already done during bind
         // (and it's probably impossible to separate them, because
@@ -402,6 +433,12 @@ std::size_t oracle_vector_use_type_backend::full_size()
 
     case x_xmltype:    break; // not supported
     case x_longstring: break; // not supported
+    case x_stringref:  break; // not supported
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
+    case x_timestamp: break; // not supported
+    case x_decimal: break; // not supported
     case x_statement:  break; // not supported
     case x_rowid:      break; // not supported
     case x_blob:       break; // not supported
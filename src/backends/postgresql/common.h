@@ -9,6 +9,8 @@
 #define SOCI_POSTGRESQL_COMMON_H_INCLUDED
 
 #include "soci/postgresql/soci-postgresql.h"
+#include "soci-decimal.h"
+#include "soci-mktime.h"
 #include <limits>
 #include <cstdio>
 #include <cstring>
@@ -24,6 +26,19 @@ namespace details
 namespace postgresql
 {
 
+// size of the buffer needed by format_timestamp_utc()
+std::size_t const timestamp_utc_buffer_size = timestamp_buffer_size + 3;
+
+// helper function for formatting timestamps with the explicit UTC offset, so
+// that they're interpreted correctly for TIMESTAMP WITH TIME ZONE columns
+// independently of the session time zone (PostgreSQL ignores the offset for
+// the columns without time zone)
+inline void format_timestamp_utc(char * buf, timestamp const & ts)
+{
+    std::size_t const len = format_timestamp(buf, ts);
+    std::strcpy(buf + len, "+00");
+}
+
 // helper function for parsing integers
 template <typename T>
 T string_to_integer(char const * buf)
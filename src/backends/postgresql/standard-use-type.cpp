@@ -13,6 +13,8 @@
 #include "soci/soci-platform.h"
 #include "soci-dtocstr.h"
 #include "soci-exchange-cast.h"
+#include "soci-mktime.h"
+#include "common.h"
 #include <libpq/libpq-fs.h> // libpq
 #include <cctype>
 #include <cstdio>
@@ -23,6 +25,7 @@
 
 using namespace soci;
 using namespace soci::details;
+using namespace soci::details::postgresql;
 
 void postgresql_standard_use_type_backend::bind_by_pos(
     int & position, void * data, exchange_type type, bool /* readOnly */)
@@ -67,6 +70,18 @@ void postgresql_standard_use_type_backend::pre_use(indicator const * ind)
         case x_stdstring:
             copy_from_string(exchange_type_cast<x_stdstring>(data_));
             break;
+        case x_stringref:
+            {
+                // libpq requires NUL-terminated parameters in text format
+                string_ref const & s = exchange_type_cast<x_stringref>(data_);
+                buf_ = new char[s.length + 1];
+                if (s.length != 0)
+                {
+                    std::memcpy(buf_, s.data, s.length);
+                }
+                buf_[s.length] = '\0';
+            }
+            break;
         case x_short:
             {
                 std::size_t const bufSize
@@ -117,6 +132,14 @@ void postgresql_standard_use_type_backend::pre_use(indicator const * ind)
                     t.tm_hour, t.tm_min, t.tm_sec);
             }
             break;
+        case x_timestamp:
+            buf_ = new char[timestamp_utc_buffer_size];
+            format_timestamp_utc(buf_, exchange_type_cast<x_timestamp>(data_));
+            break;
+        case x_decimal:
+            buf_ = new char[decimal_buffer_size];
+            format_decimal(buf_, exchange_type_cast<x_decimal>(data_));
+            break;
         case x_rowid:
             {
                 // RowID is internally identical to unsigned long
@@ -56,7 +56,7 @@ postgresql_statement_backend::postgresql_statement_backend(
     postgresql_session_backend &session, bool single_row_mode)
     : session_(session), single_row_mode_(single_row_mode),
       result_(session, NULL),
-      rowsAffectedBulk_(-1LL), justDescribed_(false),
+      rowsAffectedBulk_(-1LL), justDescribed_(false), resultPending_(false),
       hasIntoElements_(false), hasVectorIntoElements_(false),
       hasUseElements_(false), hasVectorUseElements_(false)
 {
@@ -70,6 +70,16 @@ postgresql_statement_backend::postgresql_statement_backend(
 
 postgresql_statement_backend::~postgresql_statement_backend()
 {
+    if (resultPending_)
+    {
+        // The connection can't be used for anything else until the result
+        // of the query sent by start_execute() is consumed.
+        while (PGresult * result = PQgetResult(session_.conn_))
+        {
+            PQclear(result);
+        }
+    }
+
     if (statementName_.empty() == false)
     {
         try
@@ -97,7 +107,7 @@ void postgresql_statement_backend::clean_up()
     // potential new execution.
     rowsAffectedBulk_ = -1;
 
-    // nothing to do here
+    release_buffered_bytes();
 }
 
 void postgresql_statement_backend::prepare(std::string const & query,
@@ -264,8 +274,13 @@ postgresql_statement_backend::execute(int number)
     // from the row description can be performed only once.
     // If the same statement is re-executed,
     // it will be *really* re-executed, without reusing existing data.
+    // Similarly, if the query was already sent by start_execute(), only its
+    // result needs to be retrieved.
 
-    if (justDescribed_ == false)
+    bool const wasSent = resultPending_;
+    resultPending_ = false;
+
+    if (justDescribed_ == false && wasSent == false)
     {
         // This object could have been already filled with data before.
         clean_up();
@@ -294,55 +309,11 @@ postgresql_statement_backend::execute(int number)
         if ((useByPosBuffers_.empty() == false) ||
             (useByNameBuffers_.empty() == false))
         {
-            if ((useByPosBuffers_.empty() == false) &&
-                (useByNameBuffers_.empty() == false))
-            {
-                throw soci_error(
-                    "Binding for use elements must be either by position "
-                    "or by name.");
-            }
             long long rowsAffectedBulkTemp = 0;
             for (int i = 0; i != numberOfExecutions; ++i)
             {
                 std::vector<char *> paramValues;
-
-                if (useByPosBuffers_.empty() == false)
-                {
-                    // use elements bind by position
-                    // the map of use buffers can be traversed
-                    // in its natural order
-
-                    for (UseByPosBuffersMap::iterator
-                             it = useByPosBuffers_.begin(),
-                             end = useByPosBuffers_.end();
-                         it != end; ++it)
-                    {
-                        char ** buffers = it->second;
-                        paramValues.push_back(buffers[i]);
-                    }
-                }
-                else
-                {
-                    // use elements bind by name
-
-                    for (std::vector<std::string>::iterator
-                             it = names_.begin(), end = names_.end();
-                         it != end; ++it)
-                    {
-                        UseByNameBuffersMap::iterator b
-                            = useByNameBuffers_.find(*it);
-                        if (b == useByNameBuffers_.end())
-                        {
-                            std::string msg(
-                                "Missing use element for bind by name (");
-                            msg += *it;
-                            msg += ").";
-                            throw soci_error(msg);
-                        }
-                        char ** buffers = b->second;
-                        paramValues.push_back(buffers[i]);
-                    }
-                }
+                get_parameter_values(i, paramValues);
 
                 if (stType_ == st_repeatable_query)
                 {
@@ -524,6 +495,17 @@ postgresql_statement_backend::execute(int number)
     {
         // default multi-row execution
 
+        if (wasSent)
+        {
+            // as PQexec(), use the last result, all of them must be consumed
+            // before the connection can be used again
+            result_.reset(PQgetResult(session_.conn_));
+            while (PGresult * res = PQgetResult(session_.conn_))
+            {
+                result_.reset(res);
+            }
+        }
+
         process_result = result_.check_for_data("Cannot execute query.");
     }
 
@@ -535,6 +517,7 @@ postgresql_statement_backend::execute(int number)
         rowsToConsume_ = 0;
 
         numberOfRows_ = PQntuples(result_);
+        account_for_result();
         if (numberOfRows_ == 0)
         {
             return ef_no_data;
@@ -597,6 +580,7 @@ postgresql_statement_backend::fetch(int number)
             rowsToConsume_ = 0;
 
             numberOfRows_ = PQntuples(result_);
+            account_for_result();
             if (numberOfRows_ == 0)
             {
                 return ef_no_data;
@@ -660,6 +644,199 @@ postgresql_statement_backend::fetch(int number)
     }
 }
 
+int postgresql_statement_backend::start_execute(int number)
+{
+    if (resultPending_)
+    {
+        throw soci_error("The result of the previously sent query wasn't retrieved.");
+    }
+
+    bool const hasParameters = (useByPosBuffers_.empty() == false) ||
+        (useByNameBuffers_.empty() == false);
+
+    if (justDescribed_ == false)
+    {
+        // Bulk operations execute the query several times, which can't be
+        // done without waiting for the result of each execution.
+        if (hasParameters && number > 1 && hasUseElements_ == false)
+        {
+            return -1;
+        }
+
+        clean_up();
+
+        std::vector<char *> paramValues;
+        if (hasParameters)
+        {
+            get_parameter_values(0, paramValues);
+        }
+
+        send_query(paramValues);
+        resultPending_ = true;
+    }
+
+    return PQsocket(session_.conn_);
+}
+
+bool postgresql_statement_backend::is_result_pending()
+{
+    bool waiting = resultPending_;
+
+#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
+    // In single-row mode fetch() also waits for the next row once all the
+    // rows of the current result were consumed.
+    if (single_row_mode_ && waiting == false && result_.get_result() != NULL &&
+        PQresultStatus(result_) == PGRES_SINGLE_TUPLE &&
+        currentRow_ + rowsToConsume_ >= numberOfRows_)
+    {
+        waiting = true;
+    }
+#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
+
+    if (waiting == false)
+    {
+        return false;
+    }
+
+    if (PQconsumeInput(session_.conn_) != 1)
+    {
+        throw_soci_error(session_.conn_, "Cannot read query result");
+    }
+
+    return PQisBusy(session_.conn_) != 0;
+}
+
+void postgresql_statement_backend::get_parameter_values(int row,
+    std::vector<char *> & paramValues)
+{
+    if ((useByPosBuffers_.empty() == false) &&
+        (useByNameBuffers_.empty() == false))
+    {
+        throw soci_error(
+            "Binding for use elements must be either by position "
+            "or by name.");
+    }
+
+    if (useByPosBuffers_.empty() == false)
+    {
+        // use elements bind by position
+        // the map of use buffers can be traversed
+        // in its natural order
+
+        for (UseByPosBuffersMap::iterator
+                 it = useByPosBuffers_.begin(),
+                 end = useByPosBuffers_.end();
+             it != end; ++it)
+        {
+            char ** buffers = it->second;
+            paramValues.push_back(buffers[row]);
+        }
+    }
+    else
+    {
+        // use elements bind by name
+
+        for (std::vector<std::string>::iterator
+                 it = names_.begin(), end = names_.end();
+             it != end; ++it)
+        {
+            UseByNameBuffersMap::iterator b
+                = useByNameBuffers_.find(*it);
+            if (b == useByNameBuffers_.end())
+            {
+                std::string msg(
+                    "Missing use element for bind by name (");
+                msg += *it;
+                msg += ").";
+                throw soci_error(msg);
+            }
+            char ** buffers = b->second;
+            paramValues.push_back(buffers[row]);
+        }
+    }
+}
+
+void postgresql_statement_backend::send_query(
+    std::vector<char *> & paramValues)
+{
+    int const count = static_cast<int>(paramValues.size());
+    char const * const * const values = count ? &paramValues[0] : NULL;
+
+    int result;
+    if (stType_ == st_repeatable_query)
+    {
+        result = PQsendQueryPrepared(session_.conn_, statementName_.c_str(),
+            count, values, NULL, NULL, 0);
+    }
+    else if (count == 0)
+    {
+        result = PQsendQuery(session_.conn_, query_.c_str());
+    }
+    else
+    {
+        result = PQsendQueryParams(session_.conn_, query_.c_str(),
+            count, NULL, values, NULL, NULL, 0);
+    }
+
+    if (result != 1)
+    {
+        throw_soci_error(session_.conn_, "Cannot send query");
+    }
+
+#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
+    if (single_row_mode_ && PQsetSingleRowMode(session_.conn_) != 1)
+    {
+        throw_soci_error(session_.conn_, "Cannot set single-row mode");
+    }
+#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
+}
+
+void postgresql_statement_backend::account_for_result()
+{
+    // libpq keeps the entire result in memory, so account for all of it
+    release_buffered_bytes();
+
+    // avoid iterating over all the cells when it's not needed
+    if (!is_fetch_memory_limited())
+    {
+        return;
+    }
+
+    std::size_t bytes = 0;
+    int const columns = PQnfields(result_);
+    for (int row = 0; row != numberOfRows_; ++row)
+    {
+        for (int col = 0; col != columns; ++col)
+        {
+            bytes += PQgetlength(result_, row, col) + 1;
+        }
+    }
+
+    try
+    {
+        add_buffered_bytes(bytes);
+    }
+    catch (memory_limit_error const &)
+    {
+        // free the memory immediately and discard the remaining rows, which
+        // would otherwise prevent executing any other queries
+        result_.reset();
+        numberOfRows_ = 0;
+
+#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
+        if (single_row_mode_)
+        {
+            while (PGresult * res = PQgetResult(session_.conn_))
+            {
+                PQclear(res);
+            }
+        }
+#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
+
+        throw;
+    }
+}
+
 long long postgresql_statement_backend::get_affected_rows()
 {
     // PQcmdTuples() doesn't really modify the result but it takes a non-const
@@ -10,6 +10,7 @@
 #include "soci/postgresql/soci-postgresql.h"
 #include "soci-cstrtod.h"
 #include "soci-mktime.h"
+#include "soci-exchange-cast.h"
 #include "common.h"
 #include "soci/type-wrappers.h"
 #include <libpq/libpq-fs.h> // libpq
@@ -79,6 +80,12 @@ void postgresql_vector_into_type_backend::post_fetch(bool gotData, indicator * i
 
         int const endRow = statement_.currentRow_ + statement_.rowsToConsume_;
 
+        if (type_ == x_packedstrings)
+        {
+            // all the values are appended to the buffer, start from scratch
+            exchange_type_cast<x_packedstrings>(data_).reset();
+        }
+
         for (int curRow = statement_.currentRow_, i = begin_;
              curRow != endRow; ++curRow, ++i)
         {
@@ -155,12 +162,32 @@ void postgresql_vector_into_type_backend::post_fetch(bool gotData, indicator * i
                     set_invector_(data_, i, t);
                 }
                 break;
+            case x_timestamp:
+                {
+                    timestamp ts;
+                    parse_timestamp(buf, ts);
+
+                    set_invector_(data_, i, ts);
+                }
+                break;
+            case x_decimal:
+                {
+                    decimal d;
+                    parse_decimal(buf, d);
+
+                    set_invector_(data_, i, d);
+                }
+                break;
             case x_xmltype:
                 set_invector_wrappers_<xml_type, std::string>(data_, i, buf);
                 break;
             case x_longstring:
                 set_invector_wrappers_<long_string, std::string>(data_, i, buf);
                 break;
+            case x_packedstrings:
+                exchange_type_cast<x_packedstrings>(data_).set(i, buf,
+                    PQgetlength(statement_.result_, curRow, pos));
+                break;
 
             default:
                 throw soci_error("Into element used with non-supported type.");
@@ -226,6 +253,15 @@ void postgresql_vector_into_type_backend::resize(std::size_t sz)
         case x_longstring:
             resizevector_<long_string>(data_, sz);
             break;
+        case x_timestamp:
+            resizevector_<timestamp>(data_, sz);
+            break;
+        case x_decimal:
+            resizevector_<decimal>(data_, sz);
+            break;
+        case x_packedstrings:
+            exchange_type_cast<x_packedstrings>(data_).resize(sz);
+            break;
         default:
             throw soci_error("Into vector element used with non-supported type.");
         }
@@ -294,6 +330,15 @@ std::size_t postgresql_vector_into_type_backend::full_size()
     case x_longstring:
         sz = get_vector_size<long_string>(data_);
         break;
+    case x_timestamp:
+        sz = get_vector_size<timestamp>(data_);
+        break;
+    case x_decimal:
+        sz = get_vector_size<decimal>(data_);
+        break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
     default:
         throw soci_error("Into vector element used with non-supported type.");
     }
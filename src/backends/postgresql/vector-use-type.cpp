@@ -9,6 +9,7 @@
 #include "soci/soci-platform.h"
 #include "soci/postgresql/soci-postgresql.h"
 #include "soci-dtocstr.h"
+#include "soci-exchange-cast.h"
 #include "common.h"
 #include "soci/type-wrappers.h"
 #include <libpq/libpq-fs.h> // libpq
@@ -192,6 +193,36 @@ void postgresql_vector_use_type_backend::pre_use(indicator const * ind)
                     std::strcpy(buf, v[i].value.c_str());
                 }
                 break;
+            case x_timestamp:
+                {
+                    std::vector<timestamp> * pv
+                        = static_cast<std::vector<timestamp> *>(data_);
+                    std::vector<timestamp> & v = *pv;
+
+                    buf = new char[timestamp_utc_buffer_size];
+                    format_timestamp_utc(buf, v[i]);
+                }
+                break;
+            case x_decimal:
+                {
+                    std::vector<decimal> * pv
+                        = static_cast<std::vector<decimal> *>(data_);
+                    std::vector<decimal> & v = *pv;
+
+                    buf = new char[decimal_buffer_size];
+                    format_decimal(buf, v[i]);
+                }
+                break;
+            case x_packedstrings:
+                {
+                    // the strings are already NUL-terminated and stay alive
+                    // until the statement is executed, so use them directly
+                    packed_strings const & v
+                        = exchange_type_cast<x_packedstrings>(data_);
+
+                    buf = const_cast<char *>(v.data(i));
+                }
+                break;
 
             default:
                 throw soci_error(
@@ -271,6 +302,15 @@ std::size_t postgresql_vector_use_type_backend::full_size()
     case x_longstring:
         sz = get_vector_size<long_string>(data_);
         break;
+    case x_timestamp:
+        sz = get_vector_size<timestamp>(data_);
+        break;
+    case x_decimal:
+        sz = get_vector_size<decimal>(data_);
+        break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
     default:
         throw soci_error("Use vector element used with non-supported type.");
     }
@@ -280,6 +320,13 @@ std::size_t postgresql_vector_use_type_backend::full_size()
 
 void postgresql_vector_use_type_backend::clean_up()
 {
+    if (type_ == x_packedstrings)
+    {
+        // buffers point into the user-provided object, see pre_use()
+        buffers_.clear();
+        return;
+    }
+
     std::size_t const bsize = buffers_.size();
     for (std::size_t i = 0; i != bsize; ++i)
     {
@@ -9,8 +9,13 @@
 #define SOCI_SQLITE3_COMMON_H_INCLUDED
 
 #include "soci/error.h"
+#include "soci/soci-platform.h"
+#include "soci-decimal.h"
+#include "soci-dtocstr.h"
+#include "soci-mktime.h"
 #include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <vector>
@@ -33,6 +38,48 @@ void resize_vector(void *p, std::size_t sz)
     v->resize(sz);
 }
 
+// SQLite doesn't have a dedicated type for date/time values, so besides text
+// they may be stored as integer Unix time in seconds or as floating point
+// Julian day number: convert the latter to microseconds since the Unix epoch.
+inline long long julian_day_to_microseconds(double jd)
+{
+    // 2440587.5 is the Julian day number of 1970-01-01 00:00:00 UTC.
+    double const us = (jd - 2440587.5) * 86400.0 * 1000000.0;
+    return static_cast<long long>(us < 0 ? us - 0.5 : us + 0.5);
+}
+
+// Bulk fetches store all values of a date/time column as text, so numeric
+// values have to be recognized here: integers are taken to be Unix time and
+// other numbers Julian day numbers, as above.
+inline void text_to_timestamp(char const * buf, timestamp & ts)
+{
+    char * end;
+    double const d = std::strtod(buf, &end);
+    if (end != buf && *end == '\0')
+    {
+        if (std::strpbrk(buf, ".eE") == NULL)
+        {
+            ts.microseconds = static_cast<long long>(d) * 1000000;
+        }
+        else
+        {
+            ts.microseconds = julian_day_to_microseconds(d);
+        }
+    }
+    else
+    {
+        parse_timestamp(buf, ts);
+    }
+}
+
+// Bulk fetches store the values of NUMERIC and DECIMAL columns as double, so
+// convert them to decimal using the same precision as SQLite uses for their
+// text representation.
+inline void double_to_decimal(double x, decimal & d)
+{
+    parse_decimal(double_to_cstring(x, 15).c_str(), d);
+}
+
 // helper function for parsing integers
 template <typename T>
 T string_to_integer(char const * buf)
@@ -96,6 +96,17 @@ void sqlite3_standard_into_type_backend::post_fetch(bool gotData,
                 break;
             }
 
+            case x_stringref:
+            {
+                // the data remains valid until the next step of the statement
+                string_ref &out = exchange_type_cast<x_stringref>(data_);
+                out.data = reinterpret_cast<const char*>(
+                    sqlite3_column_text(statement_.stmt_, pos)
+                );
+                out.length = sqlite3_column_bytes(statement_.stmt_, pos);
+                break;
+            }
+
             case x_short:
                 exchange_type_cast<x_short>(data_)
                     = static_cast<exchange_type_traits<x_short>::value_type >(
@@ -140,6 +151,45 @@ void sqlite3_standard_into_type_backend::post_fetch(bool gotData,
                 break;
             }
 
+            case x_timestamp:
+            {
+                timestamp &ts = exchange_type_cast<x_timestamp>(data_);
+                switch (sqlite3_column_type(statement_.stmt_, pos))
+                {
+                    case SQLITE_INTEGER:
+                        ts.microseconds =
+                            sqlite3_column_int64(statement_.stmt_, pos) * 1000000;
+                        break;
+
+                    case SQLITE_FLOAT:
+                        ts.microseconds = julian_day_to_microseconds(
+                            sqlite3_column_double(statement_.stmt_, pos));
+                        break;
+
+                    default:
+                    {
+                        const char *buf = reinterpret_cast<const char*>(
+                            sqlite3_column_text(statement_.stmt_, pos)
+                        );
+                        parse_timestamp((buf ? buf : ""), ts);
+                        break;
+                    }
+                }
+                break;
+            }
+
+            case x_decimal:
+            {
+                // SQLite formats REAL values with 15 significant digits, so
+                // the text representation is exact for INTEGER and TEXT
+                // values and as exact as possible for REAL ones.
+                const char *buf = reinterpret_cast<const char*>(
+                    sqlite3_column_text(statement_.stmt_, pos)
+                );
+                parse_decimal((buf ? buf : ""), exchange_type_cast<x_decimal>(data_));
+                break;
+            }
+
             case x_rowid:
             {
                 // RowID is internally identical to unsigned long
@@ -12,6 +12,8 @@
 #include "soci/blob.h"
 #include "soci-dtocstr.h"
 #include "soci-exchange-cast.h"
+#include "soci-decimal.h"
+#include "soci-mktime.h"
 // std
 #include <cstdio>
 #include <cstdlib>
@@ -110,6 +112,16 @@ void sqlite3_standard_use_type_backend::pre_use(indicator const * ind)
             break;
         }
 
+        case x_stringref:
+        {
+            string_ref const &s = exchange_type_cast<x_stringref>(data_);
+            col.type_ = dt_string;
+            // null pointer would be bound as SQL NULL, not as empty string
+            col.buffer_.constData_ = s.data != NULL ? s.data : "";
+            col.buffer_.size_ = s.length;
+            break;
+        }
+
         case x_short:
             col.type_ = dt_integer;
             col.int32_ = exchange_type_cast<x_short>(data_);
@@ -151,6 +163,24 @@ void sqlite3_standard_use_type_backend::pre_use(indicator const * ind)
             break;
         }
 
+        case x_timestamp:
+        {
+            col.type_ = dt_date;
+            col.buffer_.data_ = new char[timestamp_buffer_size];
+            col.buffer_.size_ = format_timestamp(col.buffer_.data_,
+                exchange_type_cast<x_timestamp>(data_));
+            break;
+        }
+
+        case x_decimal:
+        {
+            col.type_ = dt_string;
+            col.buffer_.data_ = new char[decimal_buffer_size];
+            col.buffer_.size_ = format_decimal(col.buffer_.data_,
+                exchange_type_cast<x_decimal>(data_));
+            break;
+        }
+
         case x_rowid:
         {
             col.type_ = dt_long_long;
@@ -200,7 +230,7 @@ void sqlite3_standard_use_type_backend::post_use(
 
 void sqlite3_standard_use_type_backend::clean_up()
 {
-    if (type_ != x_stdtm)
+    if (type_ != x_stdtm && type_ != x_timestamp && type_ != x_decimal)
         return;
 
     sqlite3_column &col = statement_.useData_[0][position_ - 1];
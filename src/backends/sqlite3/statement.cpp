@@ -117,12 +117,17 @@ sqlite3_statement_backend::load_rowset(int totalRows)
         numCols = static_cast<int>(columns_.size());
 
 
+    // the previously fetched rows were already consumed by the into elements
+    release_buffered_bytes();
+
     if (!databaseReady_)
     {
         retVal = ef_no_data;
     }
     else
     {
+        add_buffered_bytes(totalRows * numCols * sizeof(sqlite3_column));
+
         // make the vector big enough to hold the data we need
         dataCache_.resize(totalRows);
         for (sqlite3_recordset::iterator it = dataCache_.begin(),
@@ -143,6 +148,8 @@ sqlite3_statement_backend::load_rowset(int totalRows)
             }
             else if (SQLITE_ROW == res)
             {
+                account_for_row(i, numCols);
+
                 for (int c = 0; c < numCols; ++c)
                 {
                     const sqlite3_column_info &coldef = columns_[c];
@@ -206,6 +213,74 @@ sqlite3_statement_backend::load_rowset(int totalRows)
     return retVal;
 }
 
+// Account for the memory needed by the strings and blobs of the current row,
+// freeing the already loaded rows if this exceeds the limits.
+void sqlite3_statement_backend::account_for_row(int row, int numCols)
+{
+    std::size_t bytes = 0;
+    for (int c = 0; c < numCols; ++c)
+    {
+        switch (columns_[c].type_)
+        {
+            case dt_string:
+            case dt_date:
+            case dt_blob:
+                if (sqlite3_column_type(stmt_, c) != SQLITE_NULL)
+                {
+                    bytes += sqlite3_column_bytes(stmt_, c) + 1;
+                }
+                break;
+
+            case dt_double:
+            case dt_integer:
+            case dt_long_long:
+            case dt_unsigned_long_long:
+            case dt_xml:
+                break;
+        }
+    }
+
+    try
+    {
+        add_buffered_bytes(bytes);
+    }
+    catch (memory_limit_error const &)
+    {
+        for (int i = 0; i < row; ++i)
+        {
+            for (int c = 0; c < numCols; ++c)
+            {
+                sqlite3_column &col = dataCache_[i][c];
+                if (col.isNull_)
+                {
+                    continue;
+                }
+
+                switch (col.type_)
+                {
+                    case dt_string:
+                    case dt_date:
+                    case dt_blob:
+                        delete[] col.buffer_.data_;
+                        col.buffer_.data_ = NULL;
+                        break;
+
+                    case dt_double:
+                    case dt_integer:
+                    case dt_long_long:
+                    case dt_unsigned_long_long:
+                    case dt_xml:
+                        break;
+                }
+            }
+        }
+
+        dataCache_.clear();
+        release_buffered_bytes();
+        throw;
+    }
+}
+
 // This is used for non-bulk operations
 statement_backend::exec_fetch_result
 sqlite3_statement_backend::load_one()
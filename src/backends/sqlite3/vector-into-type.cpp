@@ -98,6 +98,12 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
         return;
     }
 
+    if (type_ == x_packedstrings)
+    {
+        // all the values are appended to the buffer, so start from scratch
+        exchange_type_cast<x_packedstrings>(data_).reset();
+    }
+
     int const endRow = static_cast<int>(statement_.dataCache_.size());
     for (int i = 0; i < endRow; ++i)
     {
@@ -196,6 +202,44 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
                 break;
             } // x_stdstring
 
+            case x_packedstrings:
+            {
+                packed_strings &v = exchange_type_cast<x_packedstrings>(data_);
+                switch (col.type_)
+                {
+                    case dt_date:
+                    case dt_string:
+                    case dt_blob:
+                        v.set(i, col.buffer_.constData_, col.buffer_.size_);
+                        break;
+
+                    case dt_double:
+                        v.set(i, double_to_cstring(col.double_));
+                        break;
+
+                    case dt_integer:
+                    {
+                        std::ostringstream ss;
+                        ss << col.int32_;
+                        v.set(i, ss.str());
+                        break;
+                    }
+
+                    case dt_long_long:
+                    case dt_unsigned_long_long:
+                    {
+                        std::ostringstream ss;
+                        ss << col.int64_;
+                        v.set(i, ss.str());
+                        break;
+                    }
+
+                    case dt_xml:
+                        throw soci_error("XML data type is not supported");
+                };
+                break;
+            } // x_packedstrings
+
             case x_short:
                 set_number_in_vector<exchange_type_traits<x_short>::value_type>(data_, i, col);
                 break;
@@ -244,6 +288,70 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
                 break;
             }
 
+            case x_timestamp:
+            {
+                timestamp ts;
+                switch (col.type_)
+                {
+                    case dt_date:
+                    case dt_string:
+                    case dt_blob:
+                        text_to_timestamp(col.buffer_.constData_, ts);
+                        break;
+
+                    case dt_double:
+                        ts.microseconds = julian_day_to_microseconds(col.double_);
+                        break;
+
+                    case dt_integer:
+                        ts.microseconds = col.int32_ * 1000000LL;
+                        break;
+
+                    case dt_long_long:
+                    case dt_unsigned_long_long:
+                        ts.microseconds = col.int64_ * 1000000;
+                        break;
+
+                    case dt_xml:
+                        throw soci_error("XML data type is not supported");
+                };
+
+                set_in_vector(data_, i, ts);
+                break;
+            }
+
+            case x_decimal:
+            {
+                decimal d;
+                switch (col.type_)
+                {
+                    case dt_date:
+                    case dt_string:
+                    case dt_blob:
+                        parse_decimal(col.buffer_.constData_, d);
+                        break;
+
+                    case dt_double:
+                        double_to_decimal(col.double_, d);
+                        break;
+
+                    case dt_integer:
+                        d.value = col.int32_;
+                        break;
+
+                    case dt_long_long:
+                    case dt_unsigned_long_long:
+                        d.value = col.int64_;
+                        break;
+
+                    case dt_xml:
+                        throw soci_error("XML data type is not supported");
+                };
+
+                set_in_vector(data_, i, d);
+                break;
+            }
+
             default:
                 throw soci_error("Into element used with non-supported type.");
         }
@@ -302,6 +410,15 @@ void sqlite3_vector_into_type_backend::resize(std::size_t sz)
     case x_stdtm:
         resize_vector<std::tm>(data_, sz);
         break;
+    case x_timestamp:
+        resize_vector<timestamp>(data_, sz);
+        break;
+    case x_decimal:
+        resize_vector<decimal>(data_, sz);
+        break;
+    case x_packedstrings:
+        exchange_type_cast<x_packedstrings>(data_).resize(sz);
+        break;
     default:
         throw soci_error("Into vector element used with non-supported type.");
     }
@@ -340,6 +457,15 @@ std::size_t sqlite3_vector_into_type_backend::size()
     case x_stdtm:
         sz = get_vector_size<std::tm>(data_);
         break;
+    case x_timestamp:
+        sz = get_vector_size<timestamp>(data_);
+        break;
+    case x_decimal:
+        sz = get_vector_size<decimal>(data_);
+        break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
     default:
         throw soci_error("Into vector element used with non-supported type.");
     }
@@ -7,6 +7,8 @@
 
 #define SOCI_SQLITE3_SOURCE
 #include "soci-exchange-cast.h"
+#include "soci-decimal.h"
+#include "soci-mktime.h"
 #include "soci/soci-platform.h"
 #include "soci/sqlite3/soci-sqlite3.h"
 #include "soci-dtocstr.h"
@@ -111,6 +113,15 @@ void sqlite3_vector_use_type_backend::pre_use(indicator const * ind)
                 break;
             }
 
+            case x_packedstrings:
+            {
+                packed_strings const &v = exchange_type_cast<x_packedstrings>(data_);
+                col.type_ = dt_string;
+                col.buffer_.constData_ = v.data(i);
+                col.buffer_.size_ = v.length(i);
+                break;
+            }
+
             case x_short:
                 col.type_ = dt_integer;
                 col.int32_ = (*static_cast<std::vector<exchange_type_traits<x_short>::value_type> *>(data_))[i];
@@ -151,6 +162,26 @@ void sqlite3_vector_use_type_backend::pre_use(indicator const * ind)
                 break;
             }
 
+            case x_timestamp:
+            {
+                timestamp const &ts = (*static_cast<std::vector<exchange_type_traits<x_timestamp>::value_type> *>(data_))[i];
+
+                col.type_ = dt_date;
+                col.buffer_.data_ = new char[timestamp_buffer_size];
+                col.buffer_.size_ = format_timestamp(col.buffer_.data_, ts);
+                break;
+            }
+
+            case x_decimal:
+            {
+                decimal const &d = (*static_cast<std::vector<exchange_type_traits<x_decimal>::value_type> *>(data_))[i];
+
+                col.type_ = dt_string;
+                col.buffer_.data_ = new char[decimal_buffer_size];
+                col.buffer_.size_ = format_decimal(col.buffer_.data_, d);
+                break;
+            }
+
             default:
                 throw soci_error(
                     "Use vector element used with non-supported type.");
@@ -188,6 +219,15 @@ std::size_t sqlite3_vector_use_type_backend::size()
     case x_stdtm:
         sz = get_vector_size<std::tm>(data_);
         break;
+    case x_timestamp:
+        sz = get_vector_size<timestamp>(data_);
+        break;
+    case x_decimal:
+        sz = get_vector_size<decimal>(data_);
+        break;
+    case x_packedstrings:
+        sz = exchange_type_cast<x_packedstrings>(data_).size();
+        break;
     default:
         throw soci_error("Use vector element used with non-supported type.");
     }
@@ -197,7 +237,7 @@ std::size_t sqlite3_vector_use_type_backend::size()
 
 void sqlite3_vector_use_type_backend::clean_up()
 {
-    if (type_ != x_stdtm)
+    if (type_ != x_stdtm && type_ != x_timestamp && type_ != x_decimal)
         return;
 
     int const pos = position_ - 1;
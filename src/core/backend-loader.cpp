@@ -26,13 +26,18 @@ using namespace soci::dynamic_backends;
 
 #include <windows.h>
 
-typedef CRITICAL_SECTION soci_mutex_t;
+typedef SRWLOCK soci_mutex_t;
 typedef HMODULE soci_handler_t;
-
-#define LOCK(x) EnterCriticalSection(x)
-#define UNLOCK(x) LeaveCriticalSection(x)
-#define MUTEX_INIT(x) InitializeCriticalSection(x)
-#define MUTEX_DEST(x) DeleteCriticalSection(x)
+typedef LONG soci_refcount_t;
+
+#define LOCK_SHARED(x) AcquireSRWLockShared(x)
+#define UNLOCK_SHARED(x) ReleaseSRWLockShared(x)
+#define LOCK(x) AcquireSRWLockExclusive(x)
+#define UNLOCK(x) ReleaseSRWLockExclusive(x)
+#define MUTEX_INIT(x) InitializeSRWLock(x)
+#define MUTEX_DEST(x)
+#define ATOMIC_INC(x) InterlockedIncrement(x)
+#define ATOMIC_DEC(x) InterlockedDecrement(x)
 #ifdef _UNICODE
 #define DLOPEN(x) LoadLibraryA(x)
 #else
@@ -56,13 +61,18 @@ typedef HMODULE soci_handler_t;
 #include <pthread.h>
 #include <dlfcn.h>
 
-typedef pthread_mutex_t soci_mutex_t;
+typedef pthread_rwlock_t soci_mutex_t;
 typedef void * soci_handler_t;
-
-#define LOCK(x) pthread_mutex_lock(x)
-#define UNLOCK(x) pthread_mutex_unlock(x)
-#define MUTEX_INIT(x) pthread_mutex_init(x, NULL)
-#define MUTEX_DEST(x) pthread_mutex_destroy(x)
+typedef long soci_refcount_t;
+
+#define LOCK_SHARED(x) pthread_rwlock_rdlock(x)
+#define UNLOCK_SHARED(x) pthread_rwlock_unlock(x)
+#define LOCK(x) pthread_rwlock_wrlock(x)
+#define UNLOCK(x) pthread_rwlock_unlock(x)
+#define MUTEX_INIT(x) pthread_rwlock_init(x, NULL)
+#define MUTEX_DEST(x) pthread_rwlock_destroy(x)
+#define ATOMIC_INC(x) __sync_add_and_fetch(x, 1)
+#define ATOMIC_DEC(x) __sync_sub_and_fetch(x, 1)
 #define DLOPEN(x) dlopen(x, RTLD_LAZY)
 #define DLCLOSE(x) dlclose(x)
 #define DLSYM(x, y) dlsym(x, y)
@@ -95,10 +105,40 @@ struct info
 typedef std::map<std::string, info> factory_map;
 factory_map factories_;
 
+// Number of connection_parameters objects using each of the registered
+// factories and the handles of the libraries providing it which were unloaded
+// while it was still used and must be closed only when it's not used any more.
+//
+// Entries are only added and removed while holding the exclusive lock, so
+// they can be accessed while holding the shared one, but the counter is then
+// modified atomically as other threads may be accessing it concurrently.
+struct factory_usage
+{
+    factory_usage() : refCount_(0) {}
+
+    soci_refcount_t refCount_;
+    std::vector<soci_handler_t> pendingHandlers_;
+};
+
+typedef std::map<backend_factory const *, factory_usage> usage_map;
+usage_map usage_;
+
 std::vector<std::string> search_paths_;
 
+// Lookups and reference counting only take this lock in shared mode, so that
+// they don't serialize sessions being opened concurrently, while registering
+// and unloading backends require exclusive access.
+//
+// Note that the atomic primitives used for the reference counts would be
+// enough to publish a new snapshot of the registry without locking too, but
+// not to know when the readers of the old one are done with it and it can be
+// freed, which is what the lock is really needed for.
 soci_mutex_t mutex_;
 
+// Set to false once the global state is destroyed, after which the backends
+// can't be used any more.
+bool initialized_ = false;
+
 std::vector<std::string> get_default_paths()
 {
     std::vector<std::string> paths;
@@ -155,12 +195,16 @@ struct static_state_mgr
         MUTEX_INIT(&mutex_);
 
         search_paths_ = get_default_paths();
+
+        initialized_ = true;
     }
 
     ~static_state_mgr()
     {
         unload_all();
 
+        initialized_ = false;
+
         MUTEX_DEST(&mutex_);
     }
 } static_state_mgr_;
@@ -174,6 +218,68 @@ private:
     soci_mutex_t * mptr;
 };
 
+class scoped_shared_lock
+{
+public:
+    scoped_shared_lock(soci_mutex_t * m) : mptr(m) { LOCK_SHARED(m); };
+    ~scoped_shared_lock() { UNLOCK_SHARED(mptr); };
+private:
+    soci_mutex_t * mptr;
+};
+
+// helper which must be called with at least the shared lock held
+void do_add_ref(backend_factory const * f)
+{
+    usage_map::iterator u = usage_.find(f);
+    if (u != usage_.end())
+    {
+        ATOMIC_INC(&u->second.refCount_);
+    }
+}
+
+// helper which must be called with the exclusive lock held
+void do_close(soci_handler_t h, backend_factory const * f)
+{
+    if (h == NULL)
+    {
+        return;
+    }
+
+    // don't unload the library while its factory is still used, this will
+    // be done when the last reference to it is released
+    usage_map::iterator u = usage_.find(f);
+    if (u != usage_.end() && u->second.refCount_ != 0)
+    {
+        u->second.pendingHandlers_.push_back(h);
+    }
+    else
+    {
+        DLCLOSE(h);
+    }
+}
+
+// helper which must be called with the exclusive lock held: forget about the
+// factory which is neither registered nor used any more
+void do_forget_if_unused(backend_factory const * f)
+{
+    usage_map::iterator u = usage_.find(f);
+    if (u == usage_.end() || u->second.refCount_ != 0)
+    {
+        return;
+    }
+
+    // the same factory may be registered under several names
+    for (factory_map::iterator i = factories_.begin(); i != factories_.end(); ++i)
+    {
+        if (i->second.factory_ == f)
+        {
+            return;
+        }
+    }
+
+    usage_.erase(u);
+}
+
 // non-synchronized helper for the other functions
 void do_unload(std::string const & name)
 {
@@ -181,13 +287,13 @@ void do_unload(std::string const & name)
 
     if (i != factories_.end())
     {
-        soci_handler_t h = i->second.handler_;
-        if (h != NULL)
-        {
-            DLCLOSE(h);
-        }
+        backend_factory const * const f = i->second.factory_;
+
+        do_close(i->second.handler_, f);
 
         factories_.erase(i);
+
+        do_forget_if_unused(f);
     }
 }
 
@@ -255,30 +361,101 @@ void do_register_backend(std::string const & name, std::string const & shared_ob
     new_entry.handler_ = h;
 
     factories_[name] = new_entry;
+    usage_[f];
 }
 
 } // unnamed namespace
 
 backend_factory const& dynamic_backends::get(std::string const& name)
 {
+    {
+        scoped_shared_lock lock(&mutex_);
+
+        factory_map::iterator i = factories_.find(name);
+
+        if (i != factories_.end())
+        {
+            do_add_ref(i->second.factory_);
+
+            return *(i->second.factory_);
+        }
+    }
+
+    // no backend found with this name, try to register it first, unless
+    // another thread has already done it while we didn't hold the lock
+
     scoped_lock lock(&mutex_);
 
     factory_map::iterator i = factories_.find(name);
 
-    if (i != factories_.end())
+    if (i == factories_.end())
     {
-        return *(i->second.factory_);
+        do_register_backend(name, std::string());
+
+        // second attempt, must succeed (the backend is already loaded)
+
+        i = factories_.find(name);
     }
 
-    // no backend found with this name, try to register it first
+    do_add_ref(i->second.factory_);
 
-    do_register_backend(name, std::string());
+    return *(i->second.factory_);
+}
 
-    // second attempt, must succeed (the backend is already loaded)
+void dynamic_backends::add_ref(backend_factory const& factory)
+{
+    if (!initialized_)
+    {
+        return;
+    }
 
-    i = factories_.find(name);
+    scoped_shared_lock lock(&mutex_);
 
-    return *(i->second.factory_);
+    do_add_ref(&factory);
+}
+
+void dynamic_backends::release(backend_factory const& factory)
+{
+    if (!initialized_)
+    {
+        return;
+    }
+
+    bool mustClose = false;
+    {
+        scoped_shared_lock lock(&mutex_);
+
+        usage_map::iterator u = usage_.find(&factory);
+        if (u == usage_.end())
+        {
+            return;
+        }
+
+        if (ATOMIC_DEC(&u->second.refCount_) == 0)
+        {
+            mustClose = !u->second.pendingHandlers_.empty();
+        }
+    }
+
+    if (mustClose)
+    {
+        scoped_lock lock(&mutex_);
+
+        // check that the factory hasn't been used again in the meanwhile
+        usage_map::iterator u = usage_.find(&factory);
+        if (u != usage_.end() && u->second.refCount_ == 0)
+        {
+            std::vector<soci_handler_t> & handlers = u->second.pendingHandlers_;
+            for (std::size_t i = 0; i != handlers.size(); ++i)
+            {
+                DLCLOSE(handlers[i]);
+            }
+
+            handlers.clear();
+
+            do_forget_if_unused(&factory);
+        }
+    }
 }
 
 SOCI_DECL std::vector<std::string>& search_paths()
@@ -307,11 +484,12 @@ SOCI_DECL void dynamic_backends::register_backend(
     new_entry.factory_ = &factory;
 
     factories_[name] = new_entry;
+    usage_[&factory];
 }
 
 SOCI_DECL std::vector<std::string> dynamic_backends::list_all()
 {
-    scoped_lock lock(&mutex_);
+    scoped_shared_lock lock(&mutex_);
 
     std::vector<std::string> ret;
     ret.reserve(factories_.size());
@@ -338,12 +516,22 @@ SOCI_DECL void dynamic_backends::unload_all()
 
     for (factory_map::iterator i = factories_.begin(); i != factories_.end(); ++i)
     {
-        soci_handler_t h = i->second.handler_;
-        if (0 != h)
-        {
-            DLCLOSE(h);
-        }
+        do_close(i->second.handler_, i->second.factory_);
     }
 
     factories_.clear();
+
+    // forget about the factories which are not used any more, the others
+    // are still needed to close their libraries when they're released
+    for (usage_map::iterator u = usage_.begin(); u != usage_.end(); )
+    {
+        if (u->second.refCount_ == 0)
+        {
+            usage_.erase(u++);
+        }
+        else
+        {
+            ++u;
+        }
+    }
 }
@@ -8,8 +8,10 @@
 
 #define SOCI_SOURCE
 #include "soci/error.h"
+#include "soci/soci-platform.h"
 #include "soci-mktime.h"
 #include <climits>
+#include <cstdio>
 #include <cstdlib>
 #include <ctime>
 
@@ -40,6 +42,33 @@ int parse10(char const * & p1, char * & p2)
     }
 }
 
+// helper functions for parsing date/time values without strtol() (for
+// timestamp): parse the decimal number at p and advance p past it
+int parse_digits(char const * & p)
+{
+    if (*p < '0' || *p > '9')
+        throw soci::soci_error("Cannot parse date/time field component.");
+
+    int v = 0;
+    for (; *p >= '0' && *p <= '9'; ++p)
+    {
+        if (v > (INT_MAX - 9) / 10)
+            throw soci::soci_error("Out of range date/time field component.");
+
+        v = v * 10 + (*p - '0');
+    }
+
+    return v;
+}
+
+void skip_separator(char const * & p, char separator)
+{
+    if (*p != separator)
+        throw soci::soci_error("Cannot parse date/time value.");
+
+    ++p;
+}
+
 } // namespace anonymous
 
 void soci::details::parse_std_tm(char const * buf, std::tm & t)
@@ -91,3 +120,112 @@ void soci::details::parse_std_tm(char const * buf, std::tm & t)
 
     mktime_from_ymdhms(t, year, month, day, hour, minute, second);
 }
+
+void soci::details::parse_timestamp(char const * buf, timestamp & ts)
+{
+    char const * p = buf;
+    int year = 1970, month = 1, day = 1;
+    int hour = 0, minute = 0, second = 0, microsecond = 0;
+
+    int a = parse_digits(p);
+    bool hasTime = true;
+    if (*p == '-')
+    {
+        // this is a date, possibly followed by the time of day
+        year = a;
+        ++p;
+        month = parse_digits(p);
+        skip_separator(p, '-');
+        day = parse_digits(p);
+
+        if (*p == ' ' || *p == 'T')
+        {
+            ++p;
+            a = parse_digits(p);
+        }
+        else
+        {
+            hasTime = false;
+        }
+    }
+
+    if (hasTime)
+    {
+        hour = a;
+        skip_separator(p, ':');
+        minute = parse_digits(p);
+        skip_separator(p, ':');
+        second = parse_digits(p);
+
+        if (*p == '.')
+        {
+            // ignore the digits beyond the microseconds
+            ++p;
+            for (int scale = 100000; *p >= '0' && *p <= '9'; ++p, scale /= 10)
+            {
+                microsecond += (*p - '0') * scale;
+            }
+        }
+    }
+
+    long long us = timestamp_from_ymdhms(year, month, day,
+                                         hour, minute, second, microsecond);
+
+    if (*p == 'Z')
+    {
+        ++p;
+    }
+    else if (*p == '+' || (*p == '-' && hasTime))
+    {
+        int const sign = *p == '-' ? -1 : 1;
+        ++p;
+
+        char const * const start = p;
+        int offsetHours = parse_digits(p);
+        int offsetMinutes = 0;
+        int offsetSeconds = 0;
+        if (p - start > 2)
+        {
+            offsetMinutes = offsetHours % 100;
+            offsetHours /= 100;
+        }
+        else if (*p == ':')
+        {
+            ++p;
+            offsetMinutes = parse_digits(p);
+            if (*p == ':')
+            {
+                ++p;
+                offsetSeconds = parse_digits(p);
+            }
+        }
+
+        us -= sign * ((offsetHours * 60 + offsetMinutes) * 60 + offsetSeconds)
+                * 1000000LL;
+    }
+
+    ts.microseconds = us;
+}
+
+std::size_t soci::details::format_timestamp(char * buf, timestamp const & ts)
+{
+    int year, month, day, hour, minute, second, microsecond;
+    timestamp_to_ymdhms(ts.microseconds,
+                        year, month, day, hour, minute, second, microsecond);
+
+    int len;
+    if (microsecond)
+    {
+        len = snprintf(buf, timestamp_buffer_size,
+                       "%04d-%02d-%02d %02d:%02d:%02d.%06d",
+                       year, month, day, hour, minute, second, microsecond);
+    }
+    else
+    {
+        len = snprintf(buf, timestamp_buffer_size,
+                       "%04d-%02d-%02d %02d:%02d:%02d",
+                       year, month, day, hour, minute, second);
+    }
+
+    return static_cast<std::size_t>(len);
+}
@@ -42,6 +42,7 @@ connection_parameters::connection_parameters(backend_factory const & factory,
     std::string const & connectString)
     : factory_(&factory), connectString_(connectString)
 {
+    dynamic_backends::add_ref(factory);
 }
 
 connection_parameters::connection_parameters(std::string const & backendName,
@@ -51,6 +52,7 @@ connection_parameters::connection_parameters(std::string const & backendName,
 }
 
 connection_parameters::connection_parameters(std::string const & fullConnectString)
+    : factory_(NULL)
 {
     std::string backendName;
     std::string connectString;
@@ -60,3 +62,43 @@ connection_parameters::connection_parameters(std::string const & fullConnectStri
     factory_ = &dynamic_backends::get(backendName);
     connectString_ = connectString;
 }
+
+connection_parameters::connection_parameters(connection_parameters const & other)
+    : factory_(other.factory_),
+      connectString_(other.connectString_),
+      options_(other.options_)
+{
+    if (factory_ != NULL)
+    {
+        dynamic_backends::add_ref(*factory_);
+    }
+}
+
+connection_parameters &
+connection_parameters::operator=(connection_parameters const & other)
+{
+    // add the reference before releasing the old one to handle self-assignment
+    if (other.factory_ != NULL)
+    {
+        dynamic_backends::add_ref(*other.factory_);
+    }
+
+    if (factory_ != NULL)
+    {
+        dynamic_backends::release(*factory_);
+    }
+
+    factory_ = other.factory_;
+    connectString_ = other.connectString_;
+    options_ = other.options_;
+
+    return *this;
+}
+
+connection_parameters::~connection_parameters()
+{
+    if (factory_ != NULL)
+    {
+        dynamic_backends::release(*factory_);
+    }
+}
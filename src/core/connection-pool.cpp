@@ -37,6 +37,20 @@ struct connection_pool::connection_pool_impl
         return false;
     }
 
+    std::size_t count_free() const
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i != sessions_.size(); ++i)
+        {
+            if (sessions_[i].first)
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
     // by convention, first == true means the entry is free (not used)
     std::vector<std::pair<bool, session *> > sessions_;
     pthread_mutex_t mtx_;
@@ -176,6 +190,21 @@ void connection_pool::give_back(std::size_t pos)
     pthread_cond_signal(&(pimpl_->cond_));
 }
 
+std::size_t connection_pool::get_free_count() const
+{
+    int cc = pthread_mutex_lock(&(pimpl_->mtx_));
+    if (cc != 0)
+    {
+        throw soci_error("Synchronization error");
+    }
+
+    std::size_t const count = pimpl_->count_free();
+
+    pthread_mutex_unlock(&(pimpl_->mtx_));
+
+    return count;
+}
+
 #else
 // Windows implementation
 
@@ -199,6 +228,20 @@ struct connection_pool::connection_pool_impl
         return false;
     }
 
+    std::size_t count_free() const
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i != sessions_.size(); ++i)
+        {
+            if (sessions_[i].first)
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
     // by convention, first == true means the entry is free (not used)
     std::vector<std::pair<bool, session *> > sessions_;
 
@@ -300,6 +343,17 @@ void connection_pool::give_back(std::size_t pos)
     ReleaseSemaphore(pimpl_->sem_, 1, NULL);
 }
 
+std::size_t connection_pool::get_free_count() const
+{
+    EnterCriticalSection(&(pimpl_->mtx_));
+
+    std::size_t const count = pimpl_->count_free();
+
+    LeaveCriticalSection(&(pimpl_->mtx_));
+
+    return count;
+}
+
 #endif // _WIN32
 
 session & connection_pool::at(std::size_t pos)
@@ -7,7 +7,9 @@
 
 #define SOCI_SOURCE
 #include "soci/into-type.h"
+#include "soci/result-cache.h"
 #include "soci/statement.h"
+#include "soci-exchange-cast.h"
 
 using namespace soci;
 using namespace soci::details;
@@ -47,6 +49,172 @@ void standard_into_type::post_fetch(bool gotData, bool calledFromFetch)
     }
 }
 
+bool standard_into_type::save_to_cache(cached_value & v) const
+{
+    v.type_ = type_;
+    v.ind_ = ind_ ? *ind_ : i_ok;
+
+    if (v.ind_ == i_null)
+    {
+        return true;
+    }
+
+    switch (type_)
+    {
+        case x_char:
+            v.int_ = exchange_type_cast<x_char>(data_);
+            return true;
+
+        case x_stdstring:
+            v.str_ = exchange_type_cast<x_stdstring>(data_);
+            return true;
+
+        case x_short:
+            v.int_ = exchange_type_cast<x_short>(data_);
+            return true;
+
+        case x_integer:
+            v.int_ = exchange_type_cast<x_integer>(data_);
+            return true;
+
+        case x_long_long:
+            v.int_ = exchange_type_cast<x_long_long>(data_);
+            return true;
+
+        case x_unsigned_long_long:
+            v.uint_ = exchange_type_cast<x_unsigned_long_long>(data_);
+            return true;
+
+        case x_double:
+            v.double_ = exchange_type_cast<x_double>(data_);
+            return true;
+
+        case x_stdtm:
+            v.tm_ = exchange_type_cast<x_stdtm>(data_);
+            return true;
+
+        case x_xmltype:
+            v.str_ = exchange_type_cast<x_xmltype>(data_).value;
+            return true;
+
+        case x_longstring:
+            v.str_ = exchange_type_cast<x_longstring>(data_).value;
+            return true;
+
+        case x_timestamp:
+            v.int_ = exchange_type_cast<x_timestamp>(data_).microseconds;
+            return true;
+
+        case x_decimal:
+            v.int_ = exchange_type_cast<x_decimal>(data_).value;
+            v.uint_ = static_cast<unsigned long long>(
+                exchange_type_cast<x_decimal>(data_).scale);
+            return true;
+
+        case x_stringref:
+            // The string points to the backend buffer which will be reused.
+        case x_statement:
+        case x_rowid:
+        case x_blob:
+        case x_packedstrings:
+            break;
+    }
+
+    return false;
+}
+
+bool standard_into_type::load_from_cache(cached_value const & v)
+{
+    // The same query could have been executed with an into element of a
+    // different type before.
+    if (v.type_ != type_)
+    {
+        return false;
+    }
+
+    if (ind_ != NULL)
+    {
+        *ind_ = v.ind_;
+    }
+
+    if (v.ind_ != i_null)
+    {
+        switch (type_)
+        {
+            case x_char:
+                exchange_type_cast<x_char>(data_) = static_cast<char>(v.int_);
+                break;
+
+            case x_stdstring:
+                exchange_type_cast<x_stdstring>(data_) = v.str_;
+                break;
+
+            case x_short:
+                exchange_type_cast<x_short>(data_) = static_cast<short>(v.int_);
+                break;
+
+            case x_integer:
+                exchange_type_cast<x_integer>(data_) = static_cast<int>(v.int_);
+                break;
+
+            case x_long_long:
+                exchange_type_cast<x_long_long>(data_) = v.int_;
+                break;
+
+            case x_unsigned_long_long:
+                exchange_type_cast<x_unsigned_long_long>(data_) = v.uint_;
+                break;
+
+            case x_double:
+                exchange_type_cast<x_double>(data_) = v.double_;
+                break;
+
+            case x_stdtm:
+                exchange_type_cast<x_stdtm>(data_) = v.tm_;
+                break;
+
+            case x_xmltype:
+                exchange_type_cast<x_xmltype>(data_).value = v.str_;
+                break;
+
+            case x_longstring:
+                exchange_type_cast<x_longstring>(data_).value = v.str_;
+                break;
+
+            case x_timestamp:
+                exchange_type_cast<x_timestamp>(data_).microseconds = v.int_;
+                break;
+
+            case x_decimal:
+                exchange_type_cast<x_decimal>(data_) =
+                    decimal(v.int_, static_cast<int>(v.uint_));
+                break;
+
+            case x_stringref:
+            case x_statement:
+            case x_rowid:
+            case x_blob:
+            case x_packedstrings:
+                // Never saved to the cache by save_to_cache().
+                break;
+        }
+    }
+
+    convert_from_base();
+
+    return true;
+}
+
+void standard_into_type::release_backend()
+{
+    if (backEnd_ != NULL)
+    {
+        backEnd_->clean_up();
+        delete backEnd_;
+        backEnd_ = NULL;
+    }
+}
+
 void standard_into_type::clean_up()
 {
     // backEnd_ might be NULL if IntoType<Row> was used
@@ -61,6 +229,16 @@ vector_into_type::~vector_into_type()
     delete backEnd_;
 }
 
+void vector_into_type::release_backend()
+{
+    if (backEnd_ != NULL)
+    {
+        backEnd_->clean_up();
+        delete backEnd_;
+        backEnd_ = NULL;
+    }
+}
+
 void vector_into_type::define(statement_impl & st, int & position)
 {
     if (backEnd_ == NULL)
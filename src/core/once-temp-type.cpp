@@ -8,6 +8,7 @@
 #define SOCI_SOURCE
 #include "soci/once-temp-type.h"
 #include "soci/ref-counted-statement.h"
+#include "soci/result-cache.h"
 #include "soci/session.h"
 
 using namespace soci;
@@ -52,6 +53,12 @@ once_temp_type & once_temp_type::operator,(use_type_ptr const & u)
     return *this;
 }
 
+once_temp_type & once_temp_type::operator,(cached_type const & c)
+{
+    rcst_->cache_results(c.timeToLive_);
+    return *this;
+}
+
 ddl_type::ddl_type(session & s)
     : s_(&s), rcst_(new ref_counted_statement(s))
 {
@@ -0,0 +1,419 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SOURCE
+#include "soci/parallel-scan.h"
+#include "soci/connection-pool.h"
+#include "soci/error.h"
+#include "soci/into.h"
+#include "soci/session.h"
+#include "soci/statement.h"
+#include "soci/use.h"
+#include "soci/values-exchange.h"
+#include "soci-thread.h"
+#include <deque>
+#include <exception>
+#include <utility>
+
+using namespace soci;
+using namespace soci::details;
+
+struct scan_queue::scan_queue_impl
+{
+    typedef std::pair<std::size_t, std::vector<values> > batch;
+
+    std::size_t capacity_;
+    std::deque<batch> batches_;
+    bool finished_;
+    bool stopped_;
+
+    mutex mtx_;
+
+    // signaled when a batch is added or removed or the scan finishes
+    condition changed_;
+};
+
+scan_queue::scan_queue(std::size_t capacity)
+{
+    if (capacity == 0)
+    {
+        throw soci_error("Invalid queue capacity");
+    }
+
+    pimpl_ = new scan_queue_impl();
+    pimpl_->capacity_ = capacity;
+    pimpl_->finished_ = false;
+    pimpl_->stopped_ = false;
+}
+
+scan_queue::~scan_queue()
+{
+    delete pimpl_;
+}
+
+bool scan_queue::pop(std::size_t & partition, std::vector<values> & rows)
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    while (pimpl_->batches_.empty())
+    {
+        if (pimpl_->finished_ || pimpl_->stopped_)
+        {
+            return false;
+        }
+
+        pimpl_->changed_.wait(pimpl_->mtx_);
+    }
+
+    scan_queue_impl::batch & front = pimpl_->batches_.front();
+    partition = front.first;
+    rows.swap(front.second);
+    pimpl_->batches_.pop_front();
+
+    pimpl_->changed_.notify_all();
+
+    return true;
+}
+
+std::size_t scan_queue::size() const
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    return pimpl_->batches_.size();
+}
+
+void scan_queue::on_batch(std::size_t partition, std::vector<values> & rows)
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    while (pimpl_->batches_.size() >= pimpl_->capacity_ &&
+        pimpl_->stopped_ == false)
+    {
+        pimpl_->changed_.wait(pimpl_->mtx_);
+    }
+
+    // nobody is going to consume the batch any more
+    if (pimpl_->stopped_)
+    {
+        return;
+    }
+
+    // avoid copying the rows by swapping them into the queue
+    pimpl_->batches_.push_back(
+        scan_queue_impl::batch(partition, std::vector<values>()));
+    pimpl_->batches_.back().second.swap(rows);
+
+    pimpl_->changed_.notify_all();
+}
+
+void scan_queue::on_finished()
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    pimpl_->finished_ = true;
+
+    pimpl_->changed_.notify_all();
+}
+
+void scan_queue::on_stop()
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    pimpl_->stopped_ = true;
+    pimpl_->batches_.clear();
+
+    pimpl_->changed_.notify_all();
+}
+
+struct parallel_scan::parallel_scan_impl
+{
+    parallel_scan_impl(connection_pool & pool, std::string const & query,
+        std::size_t partitions)
+        : pool_(pool), query_(query), partitions_(partitions),
+          batchSize_(1000), threadsCount_(partitions),
+          handler_(NULL), next_(0), running_(0), stopped_(false)
+    {}
+
+    // entry point of the worker threads
+    static void worker(void * arg)
+    {
+        static_cast<parallel_scan_impl *>(arg)->run_worker();
+    }
+
+    void run_worker();
+    void scan_partition(std::size_t partition);
+
+    // remember the first error, all the other ones are probably just its
+    // consequences
+    void set_error(std::string const & error)
+    {
+        scoped_lock lock(mtx_);
+
+        if (error_.empty())
+        {
+            error_ = error;
+        }
+
+        do_stop();
+    }
+
+    // must be called with the mutex held
+    void do_stop()
+    {
+        if (stopped_)
+        {
+            return;
+        }
+
+        stopped_ = true;
+
+        // the handler is only used while the worker threads are running
+        if (running_ != 0)
+        {
+            try
+            {
+                handler_->on_stop();
+            }
+            catch (...)
+            {
+                // nothing can be done about it here
+            }
+        }
+    }
+
+    bool is_stopped()
+    {
+        scoped_lock lock(mtx_);
+
+        return stopped_;
+    }
+
+    connection_pool & pool_;
+    std::string const query_;
+    std::size_t const partitions_;
+
+    std::size_t batchSize_;
+    std::size_t threadsCount_;
+
+    scan_handler * handler_;
+    std::vector<thread *> threads_;
+
+    // all the fields below are protected by the mutex
+    mutex mtx_;
+
+    std::size_t next_;
+    std::size_t running_;
+    bool stopped_;
+    std::string error_;
+};
+
+void parallel_scan::parallel_scan_impl::run_worker()
+{
+    for (;;)
+    {
+        std::size_t partition;
+        {
+            scoped_lock lock(mtx_);
+
+            if (stopped_ || next_ == partitions_)
+            {
+                break;
+            }
+
+            partition = next_++;
+        }
+
+        try
+        {
+            scan_partition(partition);
+        }
+        catch (std::exception const & e)
+        {
+            set_error(e.what());
+        }
+        catch (...)
+        {
+            set_error("Unknown error while scanning partition.");
+        }
+    }
+
+    // the last thread to finish notifies the handler
+    bool last;
+    {
+        scoped_lock lock(mtx_);
+
+        last = --running_ == 0;
+    }
+
+    if (last)
+    {
+        try
+        {
+            handler_->on_finished();
+        }
+        catch (...)
+        {
+            // nothing can be done about it here
+        }
+    }
+}
+
+void parallel_scan::parallel_scan_impl::scan_partition(std::size_t partition)
+{
+    session sql(pool_);
+
+    // only the parameters actually used by the query are bound
+    values v;
+    v.set("partition", static_cast<long long>(partition));
+    v.set("partitions", static_cast<long long>(partitions_));
+
+    std::vector<values> rows(batchSize_);
+    statement st = (sql.prepare << query_, into(rows), use(v));
+    st.execute();
+
+    while (st.fetch())
+    {
+        handler_->on_batch(partition, rows);
+
+        if (is_stopped())
+        {
+            break;
+        }
+
+        rows.resize(batchSize_);
+    }
+}
+
+parallel_scan::parallel_scan(connection_pool & pool,
+    std::string const & query, std::size_t partitions)
+{
+    if (partitions == 0)
+    {
+        throw soci_error("Invalid number of partitions");
+    }
+
+    pimpl_ = new parallel_scan_impl(pool, query, partitions);
+}
+
+parallel_scan::~parallel_scan()
+{
+    if (pimpl_->threads_.empty() == false)
+    {
+        stop();
+
+        try
+        {
+            wait();
+        }
+        catch (...)
+        {}
+    }
+
+    delete pimpl_;
+}
+
+void parallel_scan::set_batch_size(std::size_t batchSize)
+{
+    if (batchSize == 0)
+    {
+        throw soci_error("Invalid batch size");
+    }
+
+    pimpl_->batchSize_ = batchSize;
+}
+
+void parallel_scan::set_threads(std::size_t threads)
+{
+    if (threads == 0)
+    {
+        throw soci_error("Invalid number of threads");
+    }
+
+    pimpl_->threadsCount_ = threads;
+}
+
+void parallel_scan::start(scan_handler & handler)
+{
+    if (pimpl_->threads_.empty() == false)
+    {
+        throw soci_error("Parallel scan is already running.");
+    }
+
+    pimpl_->handler_ = &handler;
+    pimpl_->next_ = 0;
+    pimpl_->stopped_ = false;
+    pimpl_->error_.clear();
+
+    std::size_t const count = pimpl_->threadsCount_ < pimpl_->partitions_
+        ? pimpl_->threadsCount_
+        : pimpl_->partitions_;
+
+    pimpl_->running_ = count;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        try
+        {
+            pimpl_->threads_.push_back(
+                new thread(&parallel_scan_impl::worker, pimpl_));
+        }
+        catch (...)
+        {
+            // let the already started threads finish
+            bool last;
+            {
+                scoped_lock lock(pimpl_->mtx_);
+
+                pimpl_->running_ -= count - i;
+                pimpl_->do_stop();
+
+                last = pimpl_->running_ == 0;
+            }
+
+            if (i == 0)
+            {
+                throw;
+            }
+
+            pimpl_->set_error("Failed to start all scanning threads.");
+
+            // all the started threads may have already terminated
+            if (last)
+            {
+                handler.on_finished();
+            }
+            break;
+        }
+    }
+}
+
+void parallel_scan::wait()
+{
+    for (std::size_t i = 0; i != pimpl_->threads_.size(); ++i)
+    {
+        pimpl_->threads_[i]->join();
+        delete pimpl_->threads_[i];
+    }
+
+    pimpl_->threads_.clear();
+
+    if (pimpl_->error_.empty() == false)
+    {
+        throw soci_error(pimpl_->error_);
+    }
+}
+
+void parallel_scan::run(scan_handler & handler)
+{
+    start(handler);
+    wait();
+}
+
+void parallel_scan::stop()
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    pimpl_->do_stop();
+}
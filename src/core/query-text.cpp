@@ -0,0 +1,141 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SOURCE
+#include "soci/query-text.h"
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+typedef LONG soci_refcount_t;
+
+#define ATOMIC_INC(x) InterlockedIncrement(x)
+#define ATOMIC_DEC(x) InterlockedDecrement(x)
+
+#else
+
+typedef long soci_refcount_t;
+
+#define ATOMIC_INC(x) __sync_add_and_fetch(x, 1)
+#define ATOMIC_DEC(x) __sync_sub_and_fetch(x, 1)
+
+#endif // _WIN32
+
+using namespace soci;
+
+struct query_text::query_text_rep
+{
+    query_text_rep(std::string const & text, std::size_t hash)
+        : text_(text), hash_(hash), refs_(1)
+    {}
+
+    std::string const text_;
+    std::size_t const hash_;
+
+    // modified atomically as the copies sharing this object may be used by
+    // different threads, e.g. by the statements of the pooled sessions
+    soci_refcount_t refs_;
+};
+
+// empty queries are represented by NULL rep_, so that creating them doesn't
+// allocate anything
+
+query_text::query_text()
+    : rep_(NULL)
+{
+}
+
+query_text::query_text(std::string const & text)
+    : rep_(text.empty() ? NULL : new query_text_rep(text, compute_hash(text)))
+{
+}
+
+query_text::query_text(std::string const & text, std::size_t hash)
+    : rep_(text.empty() ? NULL : new query_text_rep(text, hash))
+{
+}
+
+query_text::query_text(query_text const & other)
+    : rep_(other.rep_)
+{
+    if (rep_ != NULL)
+    {
+        ATOMIC_INC(&rep_->refs_);
+    }
+}
+
+query_text & query_text::operator=(query_text const & other)
+{
+    if (other.rep_ != NULL)
+    {
+        ATOMIC_INC(&other.rep_->refs_);
+    }
+
+    if (rep_ != NULL && ATOMIC_DEC(&rep_->refs_) == 0)
+    {
+        delete rep_;
+    }
+
+    rep_ = other.rep_;
+
+    return *this;
+}
+
+query_text::~query_text()
+{
+    if (rep_ != NULL && ATOMIC_DEC(&rep_->refs_) == 0)
+    {
+        delete rep_;
+    }
+}
+
+std::string const & query_text::str() const
+{
+    static std::string const empty;
+
+    return rep_ != NULL ? rep_->text_ : empty;
+}
+
+std::size_t query_text::hash() const
+{
+    return rep_ != NULL ? rep_->hash_ : compute_hash(std::string());
+}
+
+bool query_text::operator==(query_text const & other) const
+{
+    if (rep_ == other.rep_)
+    {
+        return true;
+    }
+
+    return hash() == other.hash() && str() == other.str();
+}
+
+std::size_t query_text::compute_hash(std::string const & text)
+{
+    // use 64 bit FNV-1a parameters if size_t is big enough
+    std::size_t hash;
+    std::size_t prime;
+    if (sizeof(std::size_t) >= 8)
+    {
+        hash = static_cast<std::size_t>(14695981039346656037ULL);
+        prime = static_cast<std::size_t>(1099511628211ULL);
+    }
+    else
+    {
+        hash = 2166136261U;
+        prime = 16777619U;
+    }
+
+    for (std::string::const_iterator it = text.begin(); it != text.end(); ++it)
+    {
+        hash ^= static_cast<unsigned char>(*it);
+        hash *= prime;
+    }
+
+    return hash;
+}
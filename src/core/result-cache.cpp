@@ -0,0 +1,175 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SOURCE
+#include "soci/result-cache.h"
+#include "soci/error.h"
+#include <list>
+#include <map>
+
+using namespace soci;
+using namespace soci::details;
+
+namespace // anonymous
+{
+
+struct cache_entry
+{
+    std::string key_;
+    bool gotData_;
+    std::vector<cached_value> values_;
+
+    // Time after which the entry is not valid any more, or 0.
+    std::time_t expires_;
+};
+
+// The entries are kept in the order of their use, the most recently used
+// entry first.
+typedef std::list<cache_entry> entries_list;
+typedef std::map<std::string, entries_list::iterator> entries_map;
+
+} // namespace anonymous
+
+struct result_cache::result_cache_impl
+{
+    void erase(entries_map::iterator it)
+    {
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+
+    std::size_t maxEntries_;
+    int timeToLive_;
+
+    entries_list entries_;
+    entries_map index_;
+
+    std::size_t hits_;
+    std::size_t misses_;
+};
+
+result_cache::result_cache(std::size_t maxEntries, int timeToLive)
+{
+    if (maxEntries == 0)
+    {
+        throw soci_error("Invalid result cache size");
+    }
+
+    pimpl_ = new result_cache_impl();
+    pimpl_->maxEntries_ = maxEntries;
+    pimpl_->timeToLive_ = timeToLive;
+    pimpl_->hits_ = 0;
+    pimpl_->misses_ = 0;
+}
+
+result_cache::~result_cache()
+{
+    delete pimpl_;
+}
+
+void result_cache::invalidate()
+{
+    pimpl_->entries_.clear();
+    pimpl_->index_.clear();
+}
+
+void result_cache::invalidate(std::string const & query)
+{
+    // The key starts with the query followed by NUL, see
+    // statement_impl::get_result_cache(), so all the entries for this query
+    // are adjacent in the index.
+    std::string prefix(query);
+    prefix += '\0';
+
+    entries_map::iterator it = pimpl_->index_.lower_bound(prefix);
+    while (it != pimpl_->index_.end() &&
+        it->first.compare(0, prefix.size(), prefix) == 0)
+    {
+        pimpl_->erase(it++);
+    }
+}
+
+std::size_t result_cache::size() const
+{
+    return pimpl_->entries_.size();
+}
+
+std::size_t result_cache::get_hits() const
+{
+    return pimpl_->hits_;
+}
+
+std::size_t result_cache::get_misses() const
+{
+    return pimpl_->misses_;
+}
+
+bool result_cache::find(std::string const & key,
+    bool & gotData, std::vector<cached_value> & values)
+{
+    entries_map::iterator const it = pimpl_->index_.find(key);
+    if (it == pimpl_->index_.end())
+    {
+        return false;
+    }
+
+    entries_list::iterator const entry = it->second;
+    if (entry->expires_ != 0 && std::time(NULL) >= entry->expires_)
+    {
+        pimpl_->erase(it);
+
+        return false;
+    }
+
+    // Move the entry to the front as it's the most recently used one now.
+    pimpl_->entries_.splice(pimpl_->entries_.begin(), pimpl_->entries_, entry);
+
+    gotData = entry->gotData_;
+    values = entry->values_;
+
+    return true;
+}
+
+void result_cache::record_lookup(bool hit)
+{
+    if (hit)
+    {
+        ++pimpl_->hits_;
+    }
+    else
+    {
+        ++pimpl_->misses_;
+    }
+}
+
+void result_cache::store(std::string const & key,
+    bool gotData, std::vector<cached_value> const & values,
+    int timeToLive)
+{
+    entries_map::iterator const it = pimpl_->index_.find(key);
+    if (it != pimpl_->index_.end())
+    {
+        pimpl_->erase(it);
+    }
+    else if (pimpl_->entries_.size() == pimpl_->maxEntries_)
+    {
+        pimpl_->erase(pimpl_->index_.find(pimpl_->entries_.back().key_));
+    }
+
+    cache_entry entry;
+    entry.key_ = key;
+    entry.gotData_ = gotData;
+    entry.values_ = values;
+    if (timeToLive < 0)
+    {
+        timeToLive = pimpl_->timeToLive_;
+    }
+
+    entry.expires_ = timeToLive > 0 ? std::time(NULL) + timeToLive : 0;
+
+    pimpl_->entries_.push_front(entry);
+    pimpl_->index_[key] = pimpl_->entries_.begin();
+}
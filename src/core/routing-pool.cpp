@@ -0,0 +1,248 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SOURCE
+#include "soci/routing-pool.h"
+#include "soci/connection-pool.h"
+#include "soci/error.h"
+#include "soci/into.h"
+#include "soci/session.h"
+#include "soci-thread.h"
+#include <vector>
+
+using namespace soci;
+using namespace soci::details;
+
+namespace // anonymous
+{
+
+// Execute a trivial query using the session to check if it works.
+bool is_session_usable(session & sql)
+{
+    try
+    {
+        int one = 0;
+        sql << "select 1" + sql.get_dummy_from_clause(), into(one);
+        return one == 1;
+    }
+    catch (soci_error const &)
+    {
+        return false;
+    }
+}
+
+} // namespace anonymous
+
+struct routing_pool::routing_pool_impl
+{
+    connection_pool * primary_;
+    replica_selection selection_;
+
+    std::vector<connection_pool *> replicas_;
+
+    std::vector<bool> healthy_;
+
+    // index of the replica to use next in round robin mode
+    std::size_t next_;
+
+    mutable mutex mtx_;
+};
+
+routing_pool::routing_pool(connection_pool * primary,
+    replica_selection selection)
+{
+    if (primary == NULL)
+    {
+        throw soci_error("Invalid primary pool");
+    }
+
+    pimpl_ = new routing_pool_impl();
+    pimpl_->primary_ = primary;
+    pimpl_->selection_ = selection;
+    pimpl_->next_ = 0;
+}
+
+routing_pool::~routing_pool()
+{
+    for (std::size_t i = 0; i != pimpl_->replicas_.size(); ++i)
+    {
+        delete pimpl_->replicas_[i];
+    }
+
+    delete pimpl_->primary_;
+
+    delete pimpl_;
+}
+
+void routing_pool::add_replica(connection_pool * replica)
+{
+    if (replica == NULL)
+    {
+        throw soci_error("Invalid replica pool");
+    }
+
+    scoped_lock lock(pimpl_->mtx_);
+
+    pimpl_->replicas_.push_back(replica);
+    pimpl_->healthy_.push_back(true);
+}
+
+std::size_t routing_pool::get_replicas_count() const
+{
+    return pimpl_->replicas_.size();
+}
+
+connection_pool & routing_pool::lease_for_write()
+{
+    return *pimpl_->primary_;
+}
+
+connection_pool & routing_pool::lease_for_read()
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    std::size_t const count = pimpl_->replicas_.size();
+
+    switch (pimpl_->selection_)
+    {
+        case round_robin:
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                std::size_t const n = pimpl_->next_++ % count;
+                if (pimpl_->healthy_[n])
+                {
+                    return *pimpl_->replicas_[n];
+                }
+            }
+            break;
+
+        case least_loaded:
+            {
+                connection_pool * best = NULL;
+                std::size_t bestFree = 0;
+                for (std::size_t n = 0; n != count; ++n)
+                {
+                    if (pimpl_->healthy_[n] == false)
+                    {
+                        continue;
+                    }
+
+                    std::size_t const free =
+                        pimpl_->replicas_[n]->get_free_count();
+                    if (best == NULL || free > bestFree)
+                    {
+                        best = pimpl_->replicas_[n];
+                        bestFree = free;
+                    }
+                }
+
+                if (best != NULL)
+                {
+                    return *best;
+                }
+            }
+            break;
+    }
+
+    // no healthy replicas, fall back to the primary
+    return *pimpl_->primary_;
+}
+
+void routing_pool::set_replica_healthy(std::size_t n, bool healthy)
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    if (n >= pimpl_->replicas_.size())
+    {
+        throw soci_error("Invalid replica index");
+    }
+
+    pimpl_->healthy_[n] = healthy;
+}
+
+bool routing_pool::is_replica_healthy(std::size_t n) const
+{
+    scoped_lock lock(pimpl_->mtx_);
+
+    if (n >= pimpl_->replicas_.size())
+    {
+        throw soci_error("Invalid replica index");
+    }
+
+    return pimpl_->healthy_[n];
+}
+
+void routing_pool::check_replicas()
+{
+    for (std::size_t n = 0; n != pimpl_->replicas_.size(); ++n)
+    {
+        connection_pool & pool = *pimpl_->replicas_[n];
+
+        std::size_t pos;
+        if (pool.try_lease(pos, 0) == false)
+        {
+            continue;
+        }
+
+        // don't keep the mutex locked while accessing the database
+        bool healthy = false;
+        try
+        {
+            session & sql = pool.at(pos);
+
+            healthy = is_session_usable(sql);
+            if (healthy == false)
+            {
+                sql.reconnect();
+                healthy = is_session_usable(sql);
+            }
+        }
+        catch (...)
+        {
+            // failing to reconnect just means that the replica is unhealthy
+        }
+
+        pool.give_back(pos);
+
+        set_replica_healthy(n, healthy);
+    }
+}
+
+routed_session::routed_session(routing_pool & pool)
+    : pool_(pool), readSession_(NULL), writeSession_(NULL)
+{
+}
+
+routed_session::~routed_session()
+{
+    delete readSession_;
+    delete writeSession_;
+}
+
+session & routed_session::for_read()
+{
+    if (writeSession_ != NULL && writeSession_->is_in_transaction())
+    {
+        return *writeSession_;
+    }
+
+    if (readSession_ == NULL)
+    {
+        readSession_ = new session(pool_.lease_for_read());
+    }
+
+    return *readSession_;
+}
+
+session & routed_session::for_write()
+{
+    if (writeSession_ == NULL)
+    {
+        writeSession_ = new session(pool_.lease_for_write());
+    }
+
+    return *writeSession_;
+}
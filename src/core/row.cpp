@@ -17,7 +17,8 @@ using namespace soci;
 using namespace details;
 
 row::row()
-    : uppercaseColumnNames_(false)
+    : generation_(0)
+    , uppercaseColumnNames_(false)
     , currentPos_(0)
 {}
 
@@ -35,26 +36,52 @@ void row::add_properties(column_properties const &cp)
 {
     columns_.push_back(cp);
 
-    std::string columnName;
-    std::string const & originalName = cp.get_name();
     if (uppercaseColumnNames_)
     {
-        for (std::size_t i = 0; i != originalName.size(); ++i)
+        // rewrite the column name in the column_properties object
+        // to retain consistent views with the index built from it, unless
+        // it's already in upper case, as is the case for the names coming
+        // from the statement descriptions
+
+        std::string const & name = cp.get_name();
+        std::size_t const len = name.size();
+        std::size_t i = 0;
+        while (i != len && std::toupper(name[i]) == name[i])
         {
-            columnName.push_back(static_cast<char>(std::toupper(originalName[i])));
+            ++i;
         }
 
-        // rewrite the column name in the column_properties object
-        // as well to retain consistent views
+        if (i != len)
+        {
+            std::string columnName = name;
+            for (; i != len; ++i)
+            {
+                columnName[i] = static_cast<char>(std::toupper(columnName[i]));
+            }
 
-        columns_[columns_.size() - 1].set_name(columnName);
+            columns_.back().set_name(columnName);
+        }
     }
-    else
+}
+
+row * row::clone() const
+{
+    cxx_details::auto_ptr<row> r(new row());
+
+    r->uppercaseColumnNames_ = uppercaseColumnNames_;
+    r->columns_ = columns_;
+
+    std::size_t const hsize = holders_.size();
+    r->holders_.reserve(hsize);
+    r->indicators_.reserve(hsize);
+    for (std::size_t i = 0; i != hsize; ++i)
     {
-        columnName = originalName;
+        cxx_details::auto_ptr<indicator> ind(new indicator(*indicators_[i]));
+        r->holders_.push_back(holders_[i]->clone());
+        r->indicators_.push_back(ind.release());
     }
 
-    index_[columnName] = columns_.size() - 1;
+    return r.release();
 }
 
 std::size_t row::size() const
@@ -75,6 +102,8 @@ void row::clean_up()
     holders_.clear();
     indicators_.clear();
     index_.clear();
+
+    ++generation_;
 }
 
 indicator row::get_indicator(std::size_t pos) const
@@ -99,6 +128,16 @@ column_properties const & row::get_properties(std::string const &name) const
 
 std::size_t row::find_column(std::string const &name) const
 {
+    if (index_.empty())
+    {
+        // if there are several columns with the same name, the last one wins
+        std::size_t const csize = columns_.size();
+        for (std::size_t i = 0; i != csize; ++i)
+        {
+            index_[columns_[i].get_name()] = i;
+        }
+    }
+
     std::map<std::string, std::size_t>::const_iterator it = index_.find(name);
     if (it == index_.end())
     {
@@ -11,6 +11,14 @@
 #include "soci/connection-pool.h"
 #include "soci/soci-backend.h"
 #include "soci/query_transformation.h"
+#include "soci/statement.h"
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
 
 using namespace soci;
 using namespace soci::details;
@@ -26,6 +34,46 @@ void ensureConnected(session_backend * backEnd)
     }
 }
 
+// Name of the savepoint created before each statement executed in group commit
+// mode if only the failed statements should be undone.
+char const * const groupCommitSavepoint = "soci_group_commit";
+
+// Execute a query used internally by the session directly, without logging
+// it and without the group commit processing done by statement_impl.
+void execute_directly(session_backend & backEnd, std::string const & query)
+{
+    cxx_details::auto_ptr<statement_backend>
+        st(backEnd.make_statement_backend());
+
+    st->alloc();
+    try
+    {
+        st->prepare(query, st_one_time_query);
+        st->execute(1);
+    }
+    catch (...)
+    {
+        st->clean_up();
+        throw;
+    }
+
+    st->clean_up();
+}
+
+// Return the current time in milliseconds, only used for measuring intervals.
+unsigned long long get_current_time_ms()
+{
+#ifdef _WIN32
+    return GetTickCount64();
+#else
+    timeval tv;
+    gettimeofday(&tv, NULL);
+
+    return static_cast<unsigned long long>(tv.tv_sec) * 1000 +
+        static_cast<unsigned long long>(tv.tv_usec) / 1000;
+#endif
+}
+
 // Standard logger class used by default.
 class standard_logger_impl : public logger_impl
 {
@@ -75,7 +123,13 @@ private:
 session::session()
     : once(this), prepare(this), query_transformation_(NULL),
       logger_(new standard_logger_impl),
-      uppercaseColumnNames_(false), backEnd_(NULL),
+      uppercaseColumnNames_(false), backEnd_(NULL), resultCache_(NULL),
+      isInTransaction_(false), nestedTransactions_(0),
+      groupCommitMaxStatements_(0), groupCommitMaxDelay_(0),
+      groupCommitPending_(0), isInGroupCommit_(false),
+      groupCommitStart_(0), groupCommitUndoFailedOnly_(false),
+      groupCommitSavepointSet_(false),
+      fetchMemoryStatementLimit_(0), fetchMemorySessionLimit_(0),
       isFromPool_(false), pool_(NULL)
 {
 }
@@ -84,7 +138,13 @@ session::session(connection_parameters const & parameters)
     : once(this), prepare(this), query_transformation_(NULL),
       logger_(new standard_logger_impl),
       lastConnectParameters_(parameters),
-      uppercaseColumnNames_(false), backEnd_(NULL),
+      uppercaseColumnNames_(false), backEnd_(NULL), resultCache_(NULL),
+      isInTransaction_(false), nestedTransactions_(0),
+      groupCommitMaxStatements_(0), groupCommitMaxDelay_(0),
+      groupCommitPending_(0), isInGroupCommit_(false),
+      groupCommitStart_(0), groupCommitUndoFailedOnly_(false),
+      groupCommitSavepointSet_(false),
+      fetchMemoryStatementLimit_(0), fetchMemorySessionLimit_(0),
       isFromPool_(false), pool_(NULL)
 {
     open(lastConnectParameters_);
@@ -95,7 +155,13 @@ session::session(backend_factory const & factory,
     : once(this), prepare(this), query_transformation_(NULL),
     logger_(new standard_logger_impl),
       lastConnectParameters_(factory, connectString),
-      uppercaseColumnNames_(false), backEnd_(NULL),
+      uppercaseColumnNames_(false), backEnd_(NULL), resultCache_(NULL),
+      isInTransaction_(false), nestedTransactions_(0),
+      groupCommitMaxStatements_(0), groupCommitMaxDelay_(0),
+      groupCommitPending_(0), isInGroupCommit_(false),
+      groupCommitStart_(0), groupCommitUndoFailedOnly_(false),
+      groupCommitSavepointSet_(false),
+      fetchMemoryStatementLimit_(0), fetchMemorySessionLimit_(0),
       isFromPool_(false), pool_(NULL)
 {
     open(lastConnectParameters_);
@@ -106,7 +172,13 @@ session::session(std::string const & backendName,
     : once(this), prepare(this), query_transformation_(NULL),
       logger_(new standard_logger_impl),
       lastConnectParameters_(backendName, connectString),
-      uppercaseColumnNames_(false), backEnd_(NULL),
+      uppercaseColumnNames_(false), backEnd_(NULL), resultCache_(NULL),
+      isInTransaction_(false), nestedTransactions_(0),
+      groupCommitMaxStatements_(0), groupCommitMaxDelay_(0),
+      groupCommitPending_(0), isInGroupCommit_(false),
+      groupCommitStart_(0), groupCommitUndoFailedOnly_(false),
+      groupCommitSavepointSet_(false),
+      fetchMemoryStatementLimit_(0), fetchMemorySessionLimit_(0),
       isFromPool_(false), pool_(NULL)
 {
     open(lastConnectParameters_);
@@ -116,7 +188,13 @@ session::session(std::string const & connectString)
     : once(this), prepare(this), query_transformation_(NULL),
       logger_(new standard_logger_impl),
       lastConnectParameters_(connectString),
-      uppercaseColumnNames_(false), backEnd_(NULL),
+      uppercaseColumnNames_(false), backEnd_(NULL), resultCache_(NULL),
+      isInTransaction_(false), nestedTransactions_(0),
+      groupCommitMaxStatements_(0), groupCommitMaxDelay_(0),
+      groupCommitPending_(0), isInGroupCommit_(false),
+      groupCommitStart_(0), groupCommitUndoFailedOnly_(false),
+      groupCommitSavepointSet_(false),
+      fetchMemoryStatementLimit_(0), fetchMemorySessionLimit_(0),
       isFromPool_(false), pool_(NULL)
 {
     open(lastConnectParameters_);
@@ -125,6 +203,12 @@ session::session(std::string const & connectString)
 session::session(connection_pool & pool)
     : query_transformation_(NULL),
       logger_(new standard_logger_impl),
+      resultCache_(NULL), isInTransaction_(false), nestedTransactions_(0),
+      groupCommitMaxStatements_(0), groupCommitMaxDelay_(0),
+      groupCommitPending_(0), isInGroupCommit_(false),
+      groupCommitStart_(0), groupCommitUndoFailedOnly_(false),
+      groupCommitSavepointSet_(false),
+      fetchMemoryStatementLimit_(0), fetchMemorySessionLimit_(0),
       isFromPool_(true), pool_(&pool)
 {
     poolPosition_ = pool.lease();
@@ -139,15 +223,144 @@ session::~session()
 {
     if (isFromPool_)
     {
+        try
+        {
+            flush_group_commit();
+        }
+        catch (...)
+        {}
+
         pool_->give_back(poolPosition_);
     }
     else
     {
+        // Don't lose the changes done by the statements executed since the
+        // last group commit, as they would have been committed immediately
+        // without it.
+        if (isInGroupCommit_)
+        {
+            try
+            {
+                flush_group_commit();
+            }
+            catch (...)
+            {}
+        }
+
         delete query_transformation_;
         delete backEnd_;
     }
 }
 
+#if defined(SOCI_HAVE_CXX_C11) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+
+session::session(session && other)
+    : once(this), prepare(this), query_transformation_(NULL),
+      logger_(other.logger_),
+      uppercaseColumnNames_(false), backEnd_(NULL), resultCache_(NULL),
+      isInTransaction_(false), nestedTransactions_(0),
+      groupCommitMaxStatements_(0), groupCommitMaxDelay_(0),
+      groupCommitPending_(0), isInGroupCommit_(false),
+      groupCommitStart_(0), groupCommitUndoFailedOnly_(false),
+      groupCommitSavepointSet_(false),
+      fetchMemoryStatementLimit_(0), fetchMemorySessionLimit_(0),
+      isFromPool_(false), pool_(NULL)
+{
+    move_from(other);
+}
+
+session & session::operator=(session && other)
+{
+    if (&other != this)
+    {
+        if (statements_.empty() == false || other.statements_.empty() == false)
+        {
+            throw soci_error(
+                "Session can't be moved while it is used by statements.");
+        }
+
+        {
+            // close this session, or give it back to the pool, by moving it
+            // into a temporary object which is destroyed immediately
+            session old(std::move(*this));
+        }
+
+        move_from(other);
+    }
+
+    return *this;
+}
+
+void session::move_from(session & other)
+{
+    if (other.statements_.empty() == false)
+    {
+        throw soci_error(
+            "Session can't be moved while it is used by statements.");
+    }
+
+    query_transformation_ = other.query_transformation_;
+    other.query_transformation_ = NULL;
+
+    logger_ = other.logger_;
+    lastConnectParameters_ = other.lastConnectParameters_;
+    uppercaseColumnNames_ = other.uppercaseColumnNames_;
+    other.uppercaseColumnNames_ = false;
+    gotData_ = other.gotData_;
+
+    backEnd_ = other.backEnd_;
+    other.backEnd_ = NULL;
+
+    resultCache_ = other.resultCache_;
+    other.resultCache_ = NULL;
+
+    isInTransaction_ = other.isInTransaction_;
+    other.isInTransaction_ = false;
+    nestedTransactions_ = other.nestedTransactions_;
+    other.nestedTransactions_ = 0;
+
+    groupCommitMaxStatements_ = other.groupCommitMaxStatements_;
+    other.groupCommitMaxStatements_ = 0;
+    groupCommitMaxDelay_ = other.groupCommitMaxDelay_;
+    other.groupCommitMaxDelay_ = 0;
+    groupCommitPending_ = other.groupCommitPending_;
+    other.groupCommitPending_ = 0;
+    isInGroupCommit_ = other.isInGroupCommit_;
+    other.isInGroupCommit_ = false;
+    groupCommitStart_ = other.groupCommitStart_;
+    other.groupCommitStart_ = 0;
+    groupCommitUndoFailedOnly_ = other.groupCommitUndoFailedOnly_;
+    other.groupCommitUndoFailedOnly_ = false;
+    groupCommitSavepointSet_ = other.groupCommitSavepointSet_;
+    other.groupCommitSavepointSet_ = false;
+
+    fetchMemoryStatementLimit_ = other.fetchMemoryStatementLimit_;
+    other.fetchMemoryStatementLimit_ = 0;
+    fetchMemorySessionLimit_ = other.fetchMemorySessionLimit_;
+    other.fetchMemorySessionLimit_ = 0;
+
+    internedQueries_.swap(other.internedQueries_);
+    other.internedQueries_.clear();
+    columnDescriptions_.swap(other.columnDescriptions_);
+    other.columnDescriptions_.clear();
+
+    isFromPool_ = other.isFromPool_;
+    other.isFromPool_ = false;
+    poolPosition_ = other.poolPosition_;
+    pool_ = other.pool_;
+    other.pool_ = NULL;
+
+    // the queries must still be forwarded to the pooled session, if any
+    session * const target = isFromPool_ ? &pool_->at(poolPosition_) : this;
+    once.set_session(target);
+    prepare.set_session(target);
+
+    other.once.set_session(&other);
+    other.prepare.set_session(&other);
+}
+
+#endif // C++11
+
 void session::open(connection_parameters const & parameters)
 {
     if (isFromPool_)
@@ -168,6 +381,8 @@ void session::open(connection_parameters const & parameters)
         }
 
         backEnd_ = factory->make_session(parameters);
+        backEnd_->memoryTracker_.set_limits(fetchMemoryStatementLimit_,
+            fetchMemorySessionLimit_);
         lastConnectParameters_ = parameters;
     }
 }
@@ -193,11 +408,31 @@ void session::close()
 {
     if (isFromPool_)
     {
+        release_statements();
+
         pool_->at(poolPosition_).close();
         backEnd_ = NULL;
     }
     else
     {
+        // Don't lose the changes done since the last group commit, as in the
+        // destructor, but still close the connection if committing fails.
+        try
+        {
+            flush_group_commit();
+        }
+        catch (...)
+        {
+            release_statements();
+
+            delete backEnd_;
+            backEnd_ = NULL;
+
+            throw;
+        }
+
+        release_statements();
+
         delete backEnd_;
         backEnd_ = NULL;
     }
@@ -207,8 +442,14 @@ void session::reconnect()
 {
     if (isFromPool_)
     {
+        // The statements created using this session are registered with it
+        // and not with the pooled session, so they must be restored here.
+        release_statements();
+
         pool_->at(poolPosition_).reconnect();
         backEnd_ = pool_->at(poolPosition_).get_backend();
+
+        restore_statements();
     }
     else
     {
@@ -218,36 +459,382 @@ void session::reconnect()
             throw soci_error("Cannot reconnect without previous connection.");
         }
 
+        // Any transaction is lost with the old connection anyhow, so don't
+        // try to commit it.
+        isInTransaction_ = false;
+        nestedTransactions_ = 0;
+        isInGroupCommit_ = false;
+        groupCommitPending_ = 0;
+
         if (backEnd_ != NULL)
         {
             close();
         }
 
         backEnd_ = lastFactory->make_session(lastConnectParameters_);
+        backEnd_->memoryTracker_.set_limits(fetchMemoryStatementLimit_,
+            fetchMemorySessionLimit_);
+
+        restore_statements();
+    }
+}
+
+void session::release_statements()
+{
+    // The statement backends must be destroyed before the session backend
+    // they depend on, they're created again by restore_statements().
+    for (std::size_t i = 0; i != statements_.size(); ++i)
+    {
+        statements_[i]->release_backend();
+    }
+}
+
+void session::restore_statements()
+{
+    // Prepare all the existing statements again, so that they can continue
+    // to be used after reconnecting. Don't stop if one of them fails, to
+    // restore the others, but report the first error.
+    std::string error;
+    for (std::size_t i = 0; i != statements_.size(); ++i)
+    {
+        try
+        {
+            statements_[i]->restore_backend();
+        }
+        catch (soci_error const & e)
+        {
+            if (error.empty())
+            {
+                error = e.what();
+            }
+        }
+    }
+
+    if (!error.empty())
+    {
+        throw soci_error("Failed to restore statements after reconnecting: "
+            + error);
+    }
+}
+
+void session::register_statement(details::statement_impl * st)
+{
+    statements_.push_back(st);
+}
+
+void session::unregister_statement(details::statement_impl * st)
+{
+    // Statements are usually destroyed in the reverse order of their
+    // creation, so search from the end.
+    for (std::size_t i = statements_.size(); i != 0; --i)
+    {
+        if (statements_[i - 1] == st)
+        {
+            statements_.erase(statements_.begin() + (i - 1));
+            return;
+        }
     }
 }
 
 void session::begin()
 {
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).begin();
+        return;
+    }
+
     ensureConnected(backEnd_);
 
+    // The explicit transaction replaces the automatically started one.
+    flush_group_commit();
+
     backEnd_->begin();
+    isInTransaction_ = true;
 }
 
 void session::commit()
 {
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).commit();
+        return;
+    }
+
     ensureConnected(backEnd_);
 
+    isInTransaction_ = false;
+    nestedTransactions_ = 0;
+    isInGroupCommit_ = false;
+    groupCommitPending_ = 0;
     backEnd_->commit();
 }
 
 void session::rollback()
 {
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).rollback();
+        return;
+    }
+
     ensureConnected(backEnd_);
 
+    isInTransaction_ = false;
+    nestedTransactions_ = 0;
+    isInGroupCommit_ = false;
+    groupCommitPending_ = 0;
     backEnd_->rollback();
 }
 
+bool session::is_in_transaction() const
+{
+    if (isFromPool_)
+    {
+        return pool_->at(poolPosition_).is_in_transaction();
+    }
+    else
+    {
+        return isInTransaction_;
+    }
+}
+
+void session::set_group_commit(std::size_t maxStatements,
+    unsigned maxDelay, bool undoFailedOnly)
+{
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).set_group_commit(maxStatements, maxDelay,
+            undoFailedOnly);
+    }
+    else
+    {
+        if (maxStatements == 0)
+        {
+            flush_group_commit();
+        }
+
+        groupCommitMaxStatements_ = maxStatements;
+        groupCommitMaxDelay_ = maxDelay;
+        groupCommitUndoFailedOnly_ = undoFailedOnly;
+    }
+}
+
+void session::flush_group_commit()
+{
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).flush_group_commit();
+    }
+    else if (isInGroupCommit_)
+    {
+        // Reset the state first, the batch is lost if committing it fails.
+        isInGroupCommit_ = false;
+        groupCommitPending_ = 0;
+
+        ensureConnected(backEnd_);
+        backEnd_->commit();
+    }
+}
+
+std::size_t session::get_group_commit_pending() const
+{
+    if (isFromPool_)
+    {
+        return pool_->at(poolPosition_).get_group_commit_pending();
+    }
+    else
+    {
+        return groupCommitPending_;
+    }
+}
+
+void session::set_fetch_memory_limit(std::size_t maxStatementBytes,
+    std::size_t maxSessionBytes)
+{
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).set_fetch_memory_limit(maxStatementBytes,
+            maxSessionBytes);
+    }
+    else
+    {
+        fetchMemoryStatementLimit_ = maxStatementBytes;
+        fetchMemorySessionLimit_ = maxSessionBytes;
+
+        if (backEnd_ != NULL)
+        {
+            backEnd_->memoryTracker_.set_limits(maxStatementBytes,
+                maxSessionBytes);
+        }
+    }
+}
+
+std::size_t session::get_fetch_memory_used() const
+{
+    if (isFromPool_)
+    {
+        return pool_->at(poolPosition_).get_fetch_memory_used();
+    }
+    else
+    {
+        return backEnd_ != NULL ? backEnd_->memoryTracker_.get_used() : 0;
+    }
+}
+
+void session::group_commit_pre_execute()
+{
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).group_commit_pre_execute();
+        return;
+    }
+
+    if (groupCommitMaxStatements_ == 0 || isInTransaction_)
+    {
+        return;
+    }
+
+    ensureConnected(backEnd_);
+
+    if (isInGroupCommit_ == false)
+    {
+        backEnd_->begin();
+        isInGroupCommit_ = true;
+        groupCommitPending_ = 0;
+        groupCommitStart_ = get_current_time_ms();
+        groupCommitSavepointSet_ = false;
+    }
+
+    if (groupCommitUndoFailedOnly_)
+    {
+        group_commit_savepoint();
+    }
+}
+
+void session::group_commit_post_execute(bool succeeded)
+{
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).group_commit_post_execute(succeeded);
+        return;
+    }
+
+    if (isInGroupCommit_ == false)
+    {
+        return;
+    }
+
+    if (succeeded == false)
+    {
+        if (groupCommitSavepointSet_)
+        {
+            // Undo just the failed statement, which also makes the
+            // transaction usable again with the databases which abort it
+            // after an error. The savepoint itself is kept and released
+            // before creating the next one.
+            try
+            {
+                execute_directly(*backEnd_,
+                    backEnd_->rollback_to_savepoint(groupCommitSavepoint));
+                return;
+            }
+            catch (...)
+            {
+                // Fall back to rolling back the whole batch below.
+            }
+        }
+
+        isInGroupCommit_ = false;
+        groupCommitPending_ = 0;
+
+        try
+        {
+            backEnd_->rollback();
+        }
+        catch (...)
+        {
+            // Ignore it, the original error is more important.
+        }
+
+        return;
+    }
+
+    ++groupCommitPending_;
+
+    if (groupCommitPending_ >= groupCommitMaxStatements_ ||
+        (groupCommitMaxDelay_ != 0 &&
+            get_current_time_ms() - groupCommitStart_ >= groupCommitMaxDelay_))
+    {
+        flush_group_commit();
+    }
+}
+
+void session::group_commit_savepoint()
+{
+    // Creating a savepoint with the same name again would, with some
+    // databases, hide the previous one until the end of the transaction
+    // instead of replacing it, so release it first.
+    if (groupCommitSavepointSet_)
+    {
+        groupCommitSavepointSet_ = false;
+
+        // Savepoints are released implicitly by some databases.
+        std::string const release =
+            backEnd_->release_savepoint(groupCommitSavepoint);
+        if (release.empty() == false)
+        {
+            execute_directly(*backEnd_, release);
+        }
+    }
+
+    // Without savepoints support, the whole batch is rolled back on error.
+    std::string const query = backEnd_->set_savepoint(groupCommitSavepoint);
+    if (query.empty() == false)
+    {
+        execute_directly(*backEnd_, query);
+        groupCommitSavepointSet_ = true;
+    }
+}
+
+void session::savepoint(std::string const & name)
+{
+    ensureConnected(backEnd_);
+
+    std::string const query = backEnd_->set_savepoint(name);
+    if (query.empty())
+    {
+        throw soci_error("Savepoints are not supported by this backend.");
+    }
+
+    once << query;
+}
+
+void session::release_savepoint(std::string const & name)
+{
+    ensureConnected(backEnd_);
+
+    // Savepoints are released implicitly by some databases.
+    std::string const query = backEnd_->release_savepoint(name);
+    if (query.empty() == false)
+    {
+        once << query;
+    }
+}
+
+void session::rollback_to_savepoint(std::string const & name)
+{
+    ensureConnected(backEnd_);
+
+    std::string const query = backEnd_->rollback_to_savepoint(name);
+    if (query.empty())
+    {
+        throw soci_error("Savepoints are not supported by this backend.");
+    }
+
+    once << query;
+}
+
 std::ostringstream & session::get_query_stream()
 {
     if (isFromPool_)
@@ -282,6 +869,107 @@ std::string session::get_query() const
 }
 
 
+query_text session::intern_query(std::string const & query)
+{
+    if (isFromPool_)
+    {
+        return pool_->at(poolPosition_).intern_query(query);
+    }
+
+    // don't let the table grow indefinitely if many different queries are
+    // used, e.g. because the values are embedded in them
+    std::size_t const maxInternedQueries = 256;
+
+    std::size_t const hash = query_text::compute_hash(query);
+
+    std::map<std::size_t, query_text>::iterator const
+        it = internedQueries_.find(hash);
+    if (it != internedQueries_.end())
+    {
+        if (it->second.str() == query)
+        {
+            return it->second;
+        }
+
+        // hash collision: just don't intern this query
+        return query_text(query, hash);
+    }
+
+    if (internedQueries_.size() == maxInternedQueries)
+    {
+        internedQueries_.clear();
+    }
+
+    query_text const text(query, hash);
+    internedQueries_.insert(std::make_pair(hash, text));
+
+    return text;
+}
+
+std::vector<column_properties> const *
+session::get_column_descriptions(query_text const & query)
+{
+    if (isFromPool_)
+    {
+        return pool_->at(poolPosition_).get_column_descriptions(query);
+    }
+
+    column_descriptions_map::const_iterator const
+        it = columnDescriptions_.find(query.hash());
+    if (it == columnDescriptions_.end() ||
+        it->second.uppercaseColumnNames_ != uppercaseColumnNames_ ||
+        it->second.query_ != query)
+    {
+        return NULL;
+    }
+
+    return &it->second.columns_;
+}
+
+std::vector<column_properties> const & session::set_column_descriptions(
+    query_text const & query, std::vector<column_properties> const & columns)
+{
+    if (isFromPool_)
+    {
+        return pool_->at(poolPosition_).set_column_descriptions(query, columns);
+    }
+
+    // as with the interned queries, limit the number of remembered ones
+    std::size_t const maxDescribedQueries = 256;
+
+    column_descriptions_map::iterator it = columnDescriptions_.find(query.hash());
+    if (it == columnDescriptions_.end())
+    {
+        if (columnDescriptions_.size() == maxDescribedQueries)
+        {
+            columnDescriptions_.clear();
+        }
+
+        it = columnDescriptions_.insert(std::make_pair(query.hash(),
+            column_descriptions())).first;
+    }
+
+    // this either updates the description of the same query or forgets the
+    // description of another one in case of hash collision
+    it->second.query_ = query;
+    it->second.uppercaseColumnNames_ = uppercaseColumnNames_;
+    it->second.columns_ = columns;
+
+    return it->second.columns_;
+}
+
+void session::clear_column_descriptions()
+{
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).clear_column_descriptions();
+    }
+    else
+    {
+        columnDescriptions_.clear();
+    }
+}
+
 void session::set_query_transformation_(cxx_details::auto_ptr<details::query_transformation_function>& qtf)
 {
     if (isFromPool_)
@@ -343,6 +1031,30 @@ std::ostream * session::get_log_stream() const
     }
 }
 
+void session::set_result_cache(result_cache * cache)
+{
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).set_result_cache(cache);
+    }
+    else
+    {
+        resultCache_ = cache;
+    }
+}
+
+result_cache * session::get_result_cache() const
+{
+    if (isFromPool_)
+    {
+        return pool_->at(poolPosition_).get_result_cache();
+    }
+    else
+    {
+        return resultCache_;
+    }
+}
+
 void session::log_query(std::string const & query)
 {
     if (isFromPool_)
@@ -554,7 +1266,9 @@ statement_backend * session::make_statement_backend()
 {
     ensureConnected(backEnd_);
 
-    return backEnd_->make_statement_backend();
+    statement_backend * const st = backEnd_->make_statement_backend();
+    st->set_memory_tracker(&backEnd_->memoryTracker_);
+    return st;
 }
 
 rowid_backend * session::make_rowid_backend()
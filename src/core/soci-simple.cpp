@@ -14,7 +14,6 @@
 #include <cstdio>
 #include <ctime>
 #include <exception>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -295,7 +294,7 @@ struct statement_wrapper
 {
     statement_wrapper(session & _sql)
         : sql(_sql), st(sql), statement_state(clean), into_kind(empty), use_kind(empty),
-          next_position(0), is_ok(true) {}
+          next_position(0), last_use_position(0), is_ok(true) {}
 
     ~statement_wrapper();
 
@@ -306,38 +305,46 @@ struct statement_wrapper
     enum kind { empty, single, bulk } into_kind, use_kind;
 
     // into elements
+    // (indexed by position, the values are stored in the typed vectors
+    // at the slot recorded for the given position)
     int next_position;
     std::vector<data_type> into_types; // for both single and bulk
+    std::vector<int> into_slots;       // for both single and bulk
     std::vector<indicator> into_indicators;
-    std::map<int, std::string> into_strings;
-    std::map<int, int> into_ints;
-    std::map<int, long long> into_longlongs;
-    std::map<int, double> into_doubles;
-    std::map<int, std::tm> into_dates;
-    std::map<int, blob_wrapper *> into_blob;
+    std::vector<std::string> into_strings;
+    std::vector<int> into_ints;
+    std::vector<long long> into_longlongs;
+    std::vector<double> into_doubles;
+    std::vector<std::tm> into_dates;
+    std::vector<blob_wrapper *> into_blob;
 
     std::vector<std::vector<indicator> > into_indicators_v;
-    std::map<int, std::vector<std::string> > into_strings_v;
-    std::map<int, std::vector<int> > into_ints_v;
-    std::map<int, std::vector<long long> > into_longlongs_v;
-    std::map<int, std::vector<double> > into_doubles_v;
-    std::map<int, std::vector<std::tm> > into_dates_v;
+    std::vector<std::vector<std::string> > into_strings_v;
+    std::vector<std::vector<int> > into_ints_v;
+    std::vector<std::vector<long long> > into_longlongs_v;
+    std::vector<std::vector<double> > into_doubles_v;
+    std::vector<std::vector<std::tm> > into_dates_v;
 
     // use elements
-    std::map<std::string, indicator> use_indicators;
-    std::map<std::string, std::string> use_strings;
-    std::map<std::string, int> use_ints;
-    std::map<std::string, long long> use_longlongs;
-    std::map<std::string, double> use_doubles;
-    std::map<std::string, std::tm> use_dates;
-    std::map<std::string, blob_wrapper *> use_blob;
-
-    std::map<std::string, std::vector<indicator> > use_indicators_v;
-    std::map<std::string, std::vector<std::string> > use_strings_v;
-    std::map<std::string, std::vector<int> > use_ints_v;
-    std::map<std::string, std::vector<long long> > use_longlongs_v;
-    std::map<std::string, std::vector<double> > use_doubles_v;
-    std::map<std::string, std::vector<std::tm> > use_dates_v;
+    // (same layout as above, names are resolved to positions once per call)
+    std::vector<std::string> use_names;
+    std::vector<data_type> use_types; // for both single and bulk
+    std::vector<int> use_slots;       // for both single and bulk
+    int last_use_position;
+    std::vector<indicator> use_indicators;
+    std::vector<std::string> use_strings;
+    std::vector<int> use_ints;
+    std::vector<long long> use_longlongs;
+    std::vector<double> use_doubles;
+    std::vector<std::tm> use_dates;
+    std::vector<blob_wrapper *> use_blob;
+
+    std::vector<std::vector<indicator> > use_indicators_v;
+    std::vector<std::vector<std::string> > use_strings_v;
+    std::vector<std::vector<int> > use_ints_v;
+    std::vector<std::vector<long long> > use_longlongs_v;
+    std::vector<std::vector<double> > use_doubles_v;
+    std::vector<std::vector<std::tm> > use_dates_v;
 
     // format is: "YYYY MM DD hh mm ss", but we make the buffer bigger to
     // avoid gcc -Wformat-truncation warnings as it considers that the output
@@ -353,18 +360,20 @@ private:
 
 statement_wrapper::~statement_wrapper()
 {
-    for (std::map<int, blob_wrapper *>::iterator iter = into_blob.begin(), last = into_blob.end();
+    for (std::vector<blob_wrapper *>::iterator iter = into_blob.begin(), last = into_blob.end();
          iter != last; ++iter)
     {
-        soci_destroy_blob(iter->second);
+        soci_destroy_blob(*iter);
     }
 
-    for (std::map<std::string, blob_wrapper *>::iterator iter = use_blob.begin(), last = use_blob.end();
-         iter != last; ++iter)
+    int const use_elements = static_cast<int>(use_types.size());
+    for (int i = 0; i != use_elements; ++i)
     {
-        soci::indicator &ind = use_indicators[iter->first];
-        blob_wrapper *&blob = iter->second;
-        if (ind == i_null && blob != NULL)
+        if (use_types[i] != dt_blob)
+            continue;
+
+        blob_wrapper *blob = use_blob[use_slots[i]];
+        if (use_indicators[i] == i_null && blob != NULL)
             soci_destroy_blob(blob);
     }
 }
@@ -427,7 +436,14 @@ bool position_check_failed(statement_wrapper & wrapper, statement_wrapper::kind
         return true;
     }
 
-    if (wrapper.into_types[position] != expected_type)
+    // unsigned long long elements are stored as long long ones
+    data_type type = wrapper.into_types[position];
+    if (type == dt_unsigned_long_long)
+    {
+        type = dt_long_long;
+    }
+
+    if (wrapper.into_kind != k || type != expected_type)
     {
         wrapper.is_ok = false;
         wrapper.error_message = "No into ";
@@ -489,32 +505,49 @@ bool index_check_failed(std::vector<T> const & v,
     return false;
 }
 
-// helper for checking the uniqueness of the use element's name
-bool name_unique_check_failed(statement_wrapper & wrapper,
-    statement_wrapper::kind k, char const * name)
+// helper for checking the size of the user-provided array
+bool size_check_failed(statement_wrapper & wrapper, int size)
 {
-    bool is_unique;
-    if (k == statement_wrapper::single)
+    if (size < 0)
     {
-        typedef std::map<std::string, indicator>::const_iterator iterator;
-        iterator const it = wrapper.use_indicators.find(name);
-        is_unique = it == wrapper.use_indicators.end();
+        wrapper.is_ok = false;
+        wrapper.error_message = "Invalid size.";
+        return true;
     }
-    else
-    {
-        // vector version
 
-        typedef std::map
-            <
-                std::string,
-                std::vector<indicator>
-            >::const_iterator iterator;
+    wrapper.is_ok = true;
+    return false;
+}
+
+// helper for finding the position of the use element with the given name,
+// returns -1 if there is no such element
+int find_use_position(statement_wrapper & wrapper, char const * name)
+{
+    // the elements are typically accessed either repeatedly or in the order
+    // of their definition, so start looking from the last found one
+    int const count = static_cast<int>(wrapper.use_names.size());
+    int position = wrapper.last_use_position;
+    for (int i = 0; i != count; ++i, ++position)
+    {
+        if (position >= count)
+        {
+            position = 0;
+        }
 
-        iterator const it = wrapper.use_indicators_v.find(name);
-        is_unique = it == wrapper.use_indicators_v.end();
+        if (wrapper.use_names[position] == name)
+        {
+            wrapper.last_use_position = position;
+            return position;
+        }
     }
 
-    if (is_unique)
+    return -1;
+}
+
+// helper for checking the uniqueness of the use element's name
+bool name_unique_check_failed(statement_wrapper & wrapper, char const * name)
+{
+    if (find_use_position(wrapper, name) == -1)
     {
         wrapper.is_ok = true;
         return false;
@@ -527,132 +560,37 @@ bool name_unique_check_failed(statement_wrapper & wrapper,
     }
 }
 
-// helper for checking if the use element with the given name exists
+// helper for checking if the use element with the given name exists,
+// its position is returned in the last parameter
 bool name_exists_check_failed(statement_wrapper & wrapper,
     char const * name, data_type expected_type,
-    statement_wrapper::kind k, char const * type_name)
+    statement_wrapper::kind k, char const * type_name, int & position)
 {
-    bool name_exists = false;
-    if (k == statement_wrapper::single)
+    position = find_use_position(wrapper, name);
+    if (position != -1 &&
+        wrapper.use_kind == k &&
+        wrapper.use_types[position] == expected_type)
     {
-        switch (expected_type)
-        {
-        case dt_string:
-            {
-                typedef std::map
-                    <
-                        std::string,
-                        std::string
-                    >::const_iterator iterator;
-                iterator const it = wrapper.use_strings.find(name);
-                name_exists = (it != wrapper.use_strings.end());
-            }
-            break;
-        case dt_integer:
-            {
-                typedef std::map<std::string, int>::const_iterator iterator;
-                iterator const it = wrapper.use_ints.find(name);
-                name_exists = (it != wrapper.use_ints.end());
-            }
-            break;
-        case dt_long_long:
-        case dt_unsigned_long_long:
-            {
-                typedef std::map<std::string, long long>::const_iterator
-                    iterator;
-                iterator const it = wrapper.use_longlongs.find(name);
-                name_exists = (it != wrapper.use_longlongs.end());
-            }
-            break;
-        case dt_double:
-            {
-                typedef std::map<std::string, double>::const_iterator iterator;
-                iterator const it = wrapper.use_doubles.find(name);
-                name_exists = (it != wrapper.use_doubles.end());
-            }
-            break;
-        case dt_date:
-            {
-                typedef std::map<std::string, std::tm>::const_iterator iterator;
-                iterator const it = wrapper.use_dates.find(name);
-                name_exists = (it != wrapper.use_dates.end());
-            }
-            break;
-        case dt_blob:
-            {
-                typedef std::map<std::string, blob_wrapper *>::const_iterator iterator;
-                iterator const it = wrapper.use_blob.find(name);
-                name_exists = (it != wrapper.use_blob.end());
-            }
-        case dt_xml:
-            // no support for xml
-            break;
-        }
+        wrapper.is_ok = true;
+        return false;
     }
     else
     {
-        // vector version
-
-        switch (expected_type)
-        {
-        case dt_string:
-            {
-                typedef std::map
-                    <
-                        std::string,
-                        std::vector<std::string>
-                    >::const_iterator iterator;
-                iterator const it = wrapper.use_strings_v.find(name);
-                name_exists = (it != wrapper.use_strings_v.end());
-            }
-            break;
-        case dt_integer:
-            {
-                typedef std::map
-                    <
-                        std::string,
-                        std::vector<int>
-                    >::const_iterator iterator;
-                iterator const it = wrapper.use_ints_v.find(name);
-                name_exists = (it != wrapper.use_ints_v.end());
-            }
-            break;
-        case dt_long_long:
-        case dt_unsigned_long_long:
-            {
-                typedef std::map
-                    <
-                        std::string,
-                        std::vector<long long>
-                    >::const_iterator iterator;
-                iterator const it = wrapper.use_longlongs_v.find(name);
-                name_exists = (it != wrapper.use_longlongs_v.end());
-            }
-            break;
-        case dt_double:
-            {
-                typedef std::map<std::string,
-                    std::vector<double> >::const_iterator iterator;
-                iterator const it = wrapper.use_doubles_v.find(name);
-                name_exists = (it != wrapper.use_doubles_v.end());
-            }
-            break;
-        case dt_date:
-            {
-                typedef std::map<std::string,
-                        std::vector<std::tm> >::const_iterator iterator;
-                iterator const it = wrapper.use_dates_v.find(name);
-                name_exists = (it != wrapper.use_dates_v.end());
-            }
-            break;
-        case dt_blob:
-        case dt_xml:
-            // no support for bulk and xml load
-            break;
-        }
+        wrapper.is_ok = false;
+        wrapper.error_message = "No use ";
+        wrapper.error_message += type_name;
+        wrapper.error_message += " element with this name.";
+        return true;
     }
+}
 
-    if (name_exists)
+// helper for checking if the use element with the given name exists,
+// regardless of its type
+bool name_check_failed(statement_wrapper & wrapper,
+    char const * name, statement_wrapper::kind k, int & position)
+{
+    position = find_use_position(wrapper, name);
+    if (position != -1 && wrapper.use_kind == k)
     {
         wrapper.is_ok = true;
         return false;
@@ -660,27 +598,117 @@ bool name_exists_check_failed(statement_wrapper & wrapper,
     else
     {
         wrapper.is_ok = false;
-        wrapper.error_message = "No use ";
-        wrapper.error_message += type_name;
-        wrapper.error_message += " element with this name.";
+        wrapper.error_message = "Invalid name.";
         return true;
     }
 }
 
-// helper function for resizing all vectors<T> in the map
+// helper for adding a new default-initialized value to the typed storage,
+// returns the slot of the new value
+template <typename T>
+int add_slot(std::vector<T> & storage)
+{
+    storage.push_back(T());
+    return static_cast<int>(storage.size()) - 1;
+}
+
+// helper for adding a new into element stored in the given typed storage
+template <typename T>
+int add_into_element(statement_wrapper & wrapper, statement_wrapper::kind k,
+    data_type type, std::vector<T> & storage)
+{
+    if (cannot_add_elements(wrapper, k, true))
+    {
+        return -1;
+    }
+
+    wrapper.statement_state = statement_wrapper::defining;
+    wrapper.into_kind = k;
+
+    wrapper.into_types.push_back(type);
+    wrapper.into_slots.push_back(add_slot(storage));
+    if (k == statement_wrapper::single)
+    {
+        wrapper.into_indicators.push_back(i_ok);
+    }
+    else
+    {
+        wrapper.into_indicators_v.push_back(std::vector<indicator>());
+    }
+
+    return wrapper.next_position++;
+}
+
+// helper for adding a new use element stored in the given typed storage,
+// returns its position or -1
+template <typename T>
+int add_use_element(statement_wrapper & wrapper, statement_wrapper::kind k,
+    char const * name, data_type type, std::vector<T> & storage)
+{
+    if (cannot_add_elements(wrapper, k, false) ||
+        name_unique_check_failed(wrapper, name))
+    {
+        return -1;
+    }
+
+    wrapper.statement_state = statement_wrapper::defining;
+    wrapper.use_kind = k;
+
+    wrapper.use_names.push_back(name);
+    wrapper.use_types.push_back(type);
+    wrapper.use_slots.push_back(add_slot(storage));
+    if (k == statement_wrapper::single)
+    {
+        wrapper.use_indicators.push_back(i_ok);
+    }
+    else
+    {
+        wrapper.use_indicators_v.push_back(std::vector<indicator>());
+    }
+
+    return static_cast<int>(wrapper.use_names.size()) - 1;
+}
+
+// helper function for resizing all vectors<T> in the storage
 template <typename T>
-void resize_in_map(std::map<std::string, std::vector<T> > & m, int new_size)
+void resize_all(std::vector<std::vector<T> > & storage, int new_size)
 {
-    typedef typename std::map<std::string, std::vector<T> >::iterator iterator;
-    iterator it = m.begin();
-    iterator const end = m.end();
+    typedef typename std::vector<std::vector<T> >::iterator iterator;
+    iterator it = storage.begin();
+    iterator const end = storage.end();
     for ( ; it != end; ++it)
     {
-        std::vector<T> & v = it->second;
-        v.resize(new_size);
+        it->resize(new_size);
     }
 }
 
+// helper for reading a whole vector of into values without copying them,
+// returns NULL for empty vectors
+template <typename T>
+T const * vector_buffer(std::vector<T> const & v)
+{
+    return v.empty() ? NULL : &v[0];
+}
+
+// helper for writing a whole vector of use values, returns the number of
+// elements written
+template <typename T>
+int set_use_vector(statement_wrapper & wrapper, int position,
+    std::vector<T> & v, T const * vals, int size)
+{
+    std::vector<indicator> & ind = wrapper.use_indicators_v[position];
+
+    int const count = size < static_cast<int>(v.size()) ?
+        size : static_cast<int>(v.size());
+    for (int i = 0; i != count; ++i)
+    {
+        v[i] = vals[i];
+        ind[i] = i_ok;
+    }
+
+    return count;
+}
+
 // helper for formatting date values
 char const * format_date(statement_wrapper & wrapper, std::tm const & d)
 {
@@ -751,205 +779,103 @@ SOCI_DECL int soci_into_string(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::single;
-
-    wrapper->into_types.push_back(dt_string);
-    wrapper->into_indicators.push_back(i_ok);
-    wrapper->into_strings[wrapper->next_position]; // create new entry
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::single, dt_string, wrapper->into_strings);
 }
 
 SOCI_DECL int soci_into_int(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::single;
-
-    wrapper->into_types.push_back(dt_integer);
-    wrapper->into_indicators.push_back(i_ok);
-    wrapper->into_ints[wrapper->next_position]; // create new entry
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::single, dt_integer, wrapper->into_ints);
 }
 
 SOCI_DECL int soci_into_long_long(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::single;
-
-    wrapper->into_types.push_back(dt_long_long);
-    wrapper->into_indicators.push_back(i_ok);
-    wrapper->into_longlongs[wrapper->next_position]; // create new entry
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::single, dt_long_long, wrapper->into_longlongs);
 }
 
 SOCI_DECL int soci_into_double(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::single;
-
-    wrapper->into_types.push_back(dt_double);
-    wrapper->into_indicators.push_back(i_ok);
-    wrapper->into_doubles[wrapper->next_position]; // create new entry
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::single, dt_double, wrapper->into_doubles);
 }
 
 SOCI_DECL int soci_into_date(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::single;
-
-    wrapper->into_types.push_back(dt_date);
-    wrapper->into_indicators.push_back(i_ok);
-    wrapper->into_dates[wrapper->next_position]; // create new entry
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::single, dt_date, wrapper->into_dates);
 }
 
 SOCI_DECL int soci_into_blob(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, true))
+    int const position = add_into_element(*wrapper,
+        statement_wrapper::single, dt_blob, wrapper->into_blob);
+    if (position != -1)
     {
-        return -1;
+        wrapper->into_blob[wrapper->into_slots[position]] =
+            soci_create_blob_session(wrapper->sql);
     }
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::single;
-
-    wrapper->into_types.push_back(dt_blob);
-    wrapper->into_indicators.push_back(i_ok);
-    wrapper->into_blob[wrapper->next_position] = soci_create_blob_session(wrapper->sql); // create new entry
-    return wrapper->next_position++;
+    return position;
 }
 
 SOCI_DECL int soci_into_string_v(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::bulk;
-
-    wrapper->into_types.push_back(dt_string);
-    wrapper->into_indicators_v.push_back(std::vector<indicator>());
-    wrapper->into_strings_v[wrapper->next_position];
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::bulk, dt_string, wrapper->into_strings_v);
 }
 
 SOCI_DECL int soci_into_int_v(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::bulk;
-
-    wrapper->into_types.push_back(dt_integer);
-    wrapper->into_indicators_v.push_back(std::vector<indicator>());
-    wrapper->into_ints_v[wrapper->next_position];
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::bulk, dt_integer, wrapper->into_ints_v);
 }
 
 SOCI_DECL int soci_into_long_long_v(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::bulk;
-
-    wrapper->into_types.push_back(dt_long_long);
-    wrapper->into_indicators_v.push_back(std::vector<indicator>());
-    wrapper->into_longlongs_v[wrapper->next_position];
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::bulk, dt_long_long, wrapper->into_longlongs_v);
 }
 
 SOCI_DECL int soci_into_double_v(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::bulk;
-
-    wrapper->into_types.push_back(dt_double);
-    wrapper->into_indicators_v.push_back(std::vector<indicator>());
-    wrapper->into_doubles_v[wrapper->next_position];
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::bulk, dt_double, wrapper->into_doubles_v);
 }
 
 SOCI_DECL int soci_into_date_v(statement_handle st)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, true))
-    {
-        return -1;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->into_kind = statement_wrapper::bulk;
-
-    wrapper->into_types.push_back(dt_date);
-    wrapper->into_indicators_v.push_back(std::vector<indicator>());
-    wrapper->into_dates_v[wrapper->next_position];
-    return wrapper->next_position++;
+    return add_into_element(*wrapper,
+        statement_wrapper::bulk, dt_date, wrapper->into_dates_v);
 }
 
 SOCI_DECL int soci_get_into_state(statement_handle st, int position)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (position < 0 || position >= wrapper->next_position)
+    if (position < 0 || position >= wrapper->next_position ||
+        wrapper->into_kind != statement_wrapper::single)
     {
         wrapper->is_ok = false;
         wrapper->error_message = "Invalid position.";
@@ -971,7 +897,7 @@ SOCI_DECL char const * soci_get_into_string(statement_handle st, int position)
         return "";
     }
 
-    return wrapper->into_strings[position].c_str();
+    return wrapper->into_strings[wrapper->into_slots[position]].c_str();
 }
 
 SOCI_DECL int soci_get_into_int(statement_handle st, int position)
@@ -985,7 +911,7 @@ SOCI_DECL int soci_get_into_int(statement_handle st, int position)
         return 0;
     }
 
-    return wrapper->into_ints[position];
+    return wrapper->into_ints[wrapper->into_slots[position]];
 }
 
 SOCI_DECL long long soci_get_into_long_long(statement_handle st, int position)
@@ -999,7 +925,7 @@ SOCI_DECL long long soci_get_into_long_long(statement_handle st, int position)
         return 0LL;
     }
 
-    return wrapper->into_longlongs[position];
+    return wrapper->into_longlongs[wrapper->into_slots[position]];
 }
 
 SOCI_DECL double soci_get_into_double(statement_handle st, int position)
@@ -1013,7 +939,7 @@ SOCI_DECL double soci_get_into_double(statement_handle st, int position)
         return 0.0;
     }
 
-    return wrapper->into_doubles[position];
+    return wrapper->into_doubles[wrapper->into_slots[position]];
 }
 
 SOCI_DECL char const * soci_get_into_date(statement_handle st, int position)
@@ -1028,7 +954,7 @@ SOCI_DECL char const * soci_get_into_date(statement_handle st, int position)
     }
 
     // format is: "YYYY MM DD hh mm ss"
-    std::tm const & d = wrapper->into_dates[position];
+    std::tm const & d = wrapper->into_dates[wrapper->into_slots[position]];
     return format_date(*wrapper, d);
 }
 
@@ -1043,7 +969,7 @@ SOCI_DECL blob_handle soci_get_into_blob(statement_handle st, int position)
         return NULL;
     }
 
-    return wrapper->into_blob[position];
+    return wrapper->into_blob[wrapper->into_slots[position]];
 }
 
 SOCI_DECL int soci_into_get_size_v(statement_handle st)
@@ -1078,34 +1004,12 @@ SOCI_DECL void soci_into_resize_v(statement_handle st, int new_size)
         return;
     }
 
-    for (int i = 0; i != wrapper->next_position; ++i)
-    {
-        wrapper->into_indicators_v[i].resize(new_size);
-
-        switch (wrapper->into_types[i])
-        {
-        case dt_string:
-            wrapper->into_strings_v[i].resize(new_size);
-            break;
-        case dt_integer:
-            wrapper->into_ints_v[i].resize(new_size);
-            break;
-        case dt_long_long:
-        case dt_unsigned_long_long:
-            wrapper->into_longlongs_v[i].resize(new_size);
-            break;
-        case dt_double:
-            wrapper->into_doubles_v[i].resize(new_size);
-            break;
-        case dt_date:
-            wrapper->into_dates_v[i].resize(new_size);
-            break;
-        case dt_blob:
-        case dt_xml:
-            // no support for bulk blob
-            break;
-        }
-    }
+    resize_all(wrapper->into_indicators_v, new_size);
+    resize_all(wrapper->into_strings_v, new_size);
+    resize_all(wrapper->into_ints_v, new_size);
+    resize_all(wrapper->into_longlongs_v, new_size);
+    resize_all(wrapper->into_doubles_v, new_size);
+    resize_all(wrapper->into_dates_v, new_size);
 
     wrapper->is_ok = true;
 }
@@ -1114,7 +1018,8 @@ SOCI_DECL int soci_get_into_state_v(statement_handle st, int position, int index
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (position < 0 || position >= wrapper->next_position)
+    if (position < 0 || position >= wrapper->next_position ||
+        wrapper->into_kind != statement_wrapper::bulk)
     {
         wrapper->is_ok = false;
         wrapper->error_message = "Invalid position.";
@@ -1140,7 +1045,8 @@ SOCI_DECL char const * soci_get_into_string_v(statement_handle st, int position,
         return "";
     }
 
-    std::vector<std::string> const & v = wrapper->into_strings_v[position];
+    std::vector<std::string> const & v =
+        wrapper->into_strings_v[wrapper->into_slots[position]];
     if (index_check_failed(v, *wrapper, index) ||
         not_null_check_failed(*wrapper, position, index))
     {
@@ -1160,7 +1066,8 @@ SOCI_DECL int soci_get_into_int_v(statement_handle st, int position, int index)
         return 0;
     }
 
-    std::vector<int> const & v = wrapper->into_ints_v[position];
+    std::vector<int> const & v =
+        wrapper->into_ints_v[wrapper->into_slots[position]];
     if (index_check_failed(v, *wrapper, index) ||
         not_null_check_failed(*wrapper, position, index))
     {
@@ -1180,7 +1087,8 @@ SOCI_DECL long long soci_get_into_long_long_v(statement_handle st, int position,
         return 0;
     }
 
-    std::vector<long long> const & v = wrapper->into_longlongs_v[position];
+    std::vector<long long> const & v =
+        wrapper->into_longlongs_v[wrapper->into_slots[position]];
     if (index_check_failed(v, *wrapper, index) ||
         not_null_check_failed(*wrapper, position, index))
     {
@@ -1200,7 +1108,8 @@ SOCI_DECL double soci_get_into_double_v(statement_handle st, int position, int i
         return 0.0;
     }
 
-    std::vector<double> const & v = wrapper->into_doubles_v[position];
+    std::vector<double> const & v =
+        wrapper->into_doubles_v[wrapper->into_slots[position]];
     if (index_check_failed(v, *wrapper, index) ||
         not_null_check_failed(*wrapper, position, index))
     {
@@ -1220,7 +1129,8 @@ SOCI_DECL char const * soci_get_into_date_v(statement_handle st, int position, i
         return "";
     }
 
-    std::vector<std::tm> const & v = wrapper->into_dates_v[position];
+    std::vector<std::tm> const & v =
+        wrapper->into_dates_v[wrapper->into_slots[position]];
     if (index_check_failed(v, *wrapper, index) ||
         not_null_check_failed(*wrapper, position, index))
     {
@@ -1230,272 +1140,273 @@ SOCI_DECL char const * soci_get_into_date_v(statement_handle st, int position, i
     return format_date(*wrapper, v[index]);
 }
 
-SOCI_DECL void soci_use_string(statement_handle st, char const * name)
+SOCI_DECL int soci_get_into_states_v(statement_handle st,
+    int position, int * states, int size)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::single, name))
+    if (position < 0 || position >= wrapper->next_position ||
+        wrapper->into_kind != statement_wrapper::bulk)
     {
-        return;
+        wrapper->is_ok = false;
+        wrapper->error_message = "Invalid position.";
+        return -1;
+    }
+
+    if (size_check_failed(*wrapper, size))
+    {
+        return -1;
     }
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::single;
+    std::vector<indicator> const & v = wrapper->into_indicators_v[position];
+    int const count = size < static_cast<int>(v.size()) ?
+        size : static_cast<int>(v.size());
+    for (int i = 0; i != count; ++i)
+    {
+        states[i] = v[i] == i_ok ? 1 : 0;
+    }
 
-    wrapper->use_indicators[name] = i_ok; // create new entry
-    wrapper->use_strings[name]; // create new entry
+    return count;
 }
 
-SOCI_DECL void soci_use_int(statement_handle st, char const * name)
+SOCI_DECL int soci_get_into_strings_v(statement_handle st,
+    int position, char const ** vals, int size)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::single, name))
+    if (position_check_failed(*wrapper,
+            statement_wrapper::bulk, position, dt_string, "string") ||
+        size_check_failed(*wrapper, size))
     {
-        return;
+        return -1;
     }
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::single;
+    std::vector<std::string> const & v =
+        wrapper->into_strings_v[wrapper->into_slots[position]];
+    std::vector<indicator> const & ind = wrapper->into_indicators_v[position];
+    int const count = size < static_cast<int>(v.size()) ?
+        size : static_cast<int>(v.size());
+    for (int i = 0; i != count; ++i)
+    {
+        vals[i] = ind[i] == i_null ? NULL : v[i].c_str();
+    }
 
-    wrapper->use_indicators[name] = i_ok; // create new entry
-    wrapper->use_ints[name]; // create new entry
+    return count;
 }
 
-SOCI_DECL void soci_use_long_long(statement_handle st, char const * name)
+SOCI_DECL int const * soci_get_into_int_buffer_v(statement_handle st, int position)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::single, name))
+    if (position_check_failed(*wrapper,
+            statement_wrapper::bulk, position, dt_integer, "int"))
     {
-        return;
+        return NULL;
     }
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::single;
-
-    wrapper->use_indicators[name] = i_ok; // create new entry
-    wrapper->use_longlongs[name]; // create new entry
+    return vector_buffer(wrapper->into_ints_v[wrapper->into_slots[position]]);
 }
 
-SOCI_DECL void soci_use_double(statement_handle st, char const * name)
+SOCI_DECL long long const * soci_get_into_long_long_buffer_v(statement_handle st, int position)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::single, name))
+    if (position_check_failed(*wrapper,
+            statement_wrapper::bulk, position, dt_long_long, "long long"))
     {
-        return;
+        return NULL;
     }
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::single;
-
-    wrapper->use_indicators[name] = i_ok; // create new entry
-    wrapper->use_doubles[name]; // create new entry
+    return vector_buffer(wrapper->into_longlongs_v[wrapper->into_slots[position]]);
 }
 
-SOCI_DECL void soci_use_date(statement_handle st, char const * name)
+SOCI_DECL double const * soci_get_into_double_buffer_v(statement_handle st, int position)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::single, name))
+    if (position_check_failed(*wrapper,
+            statement_wrapper::bulk, position, dt_double, "double"))
     {
-        return;
+        return NULL;
     }
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::single;
+    return vector_buffer(wrapper->into_doubles_v[wrapper->into_slots[position]]);
+}
+
+SOCI_DECL void soci_use_string(statement_handle st, char const * name)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    wrapper->use_indicators[name] = i_ok; // create new entry
-    wrapper->use_dates[name]; // create new entry
+    add_use_element(*wrapper,
+        statement_wrapper::single, name, dt_string, wrapper->use_strings);
 }
 
-SOCI_DECL void soci_use_blob(statement_handle st, char const * name)
+SOCI_DECL void soci_use_int(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::single, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::single, name))
-    {
-        return;
-    }
+    add_use_element(*wrapper,
+        statement_wrapper::single, name, dt_integer, wrapper->use_ints);
+}
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::single;
+SOCI_DECL void soci_use_long_long(statement_handle st, char const * name)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    wrapper->use_indicators[name] = i_null; // create new entry
-    wrapper->use_blob[name] = soci_create_blob_session(wrapper->sql); // create new entry
+    add_use_element(*wrapper,
+        statement_wrapper::single, name, dt_long_long, wrapper->use_longlongs);
 }
 
-SOCI_DECL void soci_use_string_v(statement_handle st, char const * name)
+SOCI_DECL void soci_use_double(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::bulk, name))
-    {
-        return;
-    }
+    add_use_element(*wrapper,
+        statement_wrapper::single, name, dt_double, wrapper->use_doubles);
+}
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::bulk;
+SOCI_DECL void soci_use_date(statement_handle st, char const * name)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    wrapper->use_indicators_v[name]; // create new entry
-    wrapper->use_strings_v[name]; // create new entry
+    add_use_element(*wrapper,
+        statement_wrapper::single, name, dt_date, wrapper->use_dates);
 }
 
-SOCI_DECL void soci_use_int_v(statement_handle st, char const * name)
+SOCI_DECL void soci_use_blob(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::bulk, name))
+    int const position = add_use_element(*wrapper,
+        statement_wrapper::single, name, dt_blob, wrapper->use_blob);
+    if (position != -1)
     {
-        return;
+        wrapper->use_indicators[position] = i_null;
+        wrapper->use_blob[wrapper->use_slots[position]] =
+            soci_create_blob_session(wrapper->sql);
     }
+}
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::bulk;
+SOCI_DECL void soci_use_string_v(statement_handle st, char const * name)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    wrapper->use_indicators_v[name]; // create new entry
-    wrapper->use_ints_v[name]; // create new entry
+    add_use_element(*wrapper,
+        statement_wrapper::bulk, name, dt_string, wrapper->use_strings_v);
 }
 
-SOCI_DECL void soci_use_long_long_v(statement_handle st, char const * name)
+SOCI_DECL void soci_use_int_v(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::bulk, name))
-    {
-        return;
-    }
+    add_use_element(*wrapper,
+        statement_wrapper::bulk, name, dt_integer, wrapper->use_ints_v);
+}
 
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::bulk;
+SOCI_DECL void soci_use_long_long_v(statement_handle st, char const * name)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    wrapper->use_indicators_v[name]; // create new entry
-    wrapper->use_longlongs_v[name]; // create new entry
+    add_use_element(*wrapper,
+        statement_wrapper::bulk, name, dt_long_long, wrapper->use_longlongs_v);
 }
 
 SOCI_DECL void soci_use_double_v(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::bulk, name))
-    {
-        return;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::bulk;
-
-    wrapper->use_indicators_v[name]; // create new entry
-    wrapper->use_doubles_v[name]; // create new entry
+    add_use_element(*wrapper,
+        statement_wrapper::bulk, name, dt_double, wrapper->use_doubles_v);
 }
 
 SOCI_DECL void soci_use_date_v(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    if (cannot_add_elements(*wrapper, statement_wrapper::bulk, false) ||
-        name_unique_check_failed(*wrapper, statement_wrapper::bulk, name))
-    {
-        return;
-    }
-
-    wrapper->statement_state = statement_wrapper::defining;
-    wrapper->use_kind = statement_wrapper::bulk;
-
-    wrapper->use_indicators_v[name]; // create new entry
-    wrapper->use_dates_v[name]; // create new entry
+    add_use_element(*wrapper,
+        statement_wrapper::bulk, name, dt_date, wrapper->use_dates_v);
 }
 
 SOCI_DECL void soci_set_use_state(statement_handle st, char const * name, int state)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    typedef std::map<std::string, indicator>::const_iterator iterator;
-    iterator const it = wrapper->use_indicators.find(name);
-    if (it == wrapper->use_indicators.end())
+    int position;
+    if (name_check_failed(*wrapper, name, statement_wrapper::single, position))
     {
-        wrapper->is_ok = false;
-        wrapper->error_message = "Invalid name.";
         return;
     }
 
-    wrapper->is_ok = true;
-    wrapper->use_indicators[name] = (state != 0 ? i_ok : i_null);
+    wrapper->use_indicators[position] = (state != 0 ? i_ok : i_null);
 }
 
 SOCI_DECL void soci_set_use_string(statement_handle st, char const * name, char const * val)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_string, statement_wrapper::single, "string"))
+            name, dt_string, statement_wrapper::single, "string", position))
     {
         return;
     }
 
-    wrapper->use_indicators[name] = i_ok;
-    wrapper->use_strings[name] = val;
+    wrapper->use_indicators[position] = i_ok;
+    wrapper->use_strings[wrapper->use_slots[position]] = val;
 }
 
 SOCI_DECL void soci_set_use_int(statement_handle st, char const * name, int val)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_integer, statement_wrapper::single, "int"))
+            name, dt_integer, statement_wrapper::single, "int", position))
     {
         return;
     }
 
-    wrapper->use_indicators[name] = i_ok;
-    wrapper->use_ints[name] = val;
+    wrapper->use_indicators[position] = i_ok;
+    wrapper->use_ints[wrapper->use_slots[position]] = val;
 }
 
 SOCI_DECL void soci_set_use_long_long(statement_handle st, char const * name, long long val)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_long_long, statement_wrapper::single, "long long"))
+            name, dt_long_long, statement_wrapper::single, "long long", position))
     {
         return;
     }
 
-    wrapper->use_indicators[name] = i_ok;
-    wrapper->use_longlongs[name] = val;
+    wrapper->use_indicators[position] = i_ok;
+    wrapper->use_longlongs[wrapper->use_slots[position]] = val;
 }
 
 SOCI_DECL void soci_set_use_double(statement_handle st, char const * name, double val)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_double, statement_wrapper::single, "double"))
+            name, dt_double, statement_wrapper::single, "double", position))
     {
         return;
     }
 
-    wrapper->use_indicators[name] = i_ok;
-    wrapper->use_doubles[name] = val;
+    wrapper->use_indicators[position] = i_ok;
+    wrapper->use_doubles[wrapper->use_slots[position]] = val;
 }
 
 SOCI_DECL void soci_set_use_date(statement_handle st, char const * name, char const * val)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_date, statement_wrapper::single, "date"))
+            name, dt_date, statement_wrapper::single, "date", position))
     {
         return;
     }
@@ -1507,22 +1418,23 @@ SOCI_DECL void soci_set_use_date(statement_handle st, char const * name, char co
         return;
     }
 
-    wrapper->use_indicators[name] = i_ok;
-    wrapper->use_dates[name] = dt;
+    wrapper->use_indicators[position] = i_ok;
+    wrapper->use_dates[wrapper->use_slots[position]] = dt;
 }
 
 SOCI_DECL void soci_set_use_blob(statement_handle st, char const * name, blob_handle b)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_blob, statement_wrapper::single, "blob"))
+            name, dt_blob, statement_wrapper::single, "blob", position))
     {
         return;
     }
 
-    soci::indicator &ind = wrapper->use_indicators[name];
-    blob_wrapper *&blob = wrapper->use_blob[name];
+    soci::indicator &ind = wrapper->use_indicators[position];
+    blob_wrapper *&blob = wrapper->use_blob[wrapper->use_slots[position]];
     if (ind == i_null && blob != NULL)
         soci_destroy_blob(blob);
 
@@ -1548,7 +1460,7 @@ SOCI_DECL int soci_use_get_size_v(statement_handle st)
         return -1;
     }
 
-    return static_cast<int>(wrapper->use_indicators_v.begin()->second.size());
+    return static_cast<int>(wrapper->use_indicators_v[0].size());
 }
 
 SOCI_DECL void soci_use_resize_v(statement_handle st, int new_size)
@@ -1569,12 +1481,12 @@ SOCI_DECL void soci_use_resize_v(statement_handle st, int new_size)
         return;
     }
 
-    resize_in_map(wrapper->use_indicators_v, new_size);
-    resize_in_map(wrapper->use_strings_v, new_size);
-    resize_in_map(wrapper->use_ints_v, new_size);
-    resize_in_map(wrapper->use_longlongs_v, new_size);
-    resize_in_map(wrapper->use_doubles_v, new_size);
-    resize_in_map(wrapper->use_dates_v, new_size);
+    resize_all(wrapper->use_indicators_v, new_size);
+    resize_all(wrapper->use_strings_v, new_size);
+    resize_all(wrapper->use_ints_v, new_size);
+    resize_all(wrapper->use_longlongs_v, new_size);
+    resize_all(wrapper->use_doubles_v, new_size);
+    resize_all(wrapper->use_dates_v, new_size);
 
     wrapper->is_ok = true;
 }
@@ -1584,16 +1496,13 @@ SOCI_DECL void soci_set_use_state_v(statement_handle st,
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    typedef std::map<std::string, std::vector<indicator> >::iterator iterator;
-    iterator const it = wrapper->use_indicators_v.find(name);
-    if (it == wrapper->use_indicators_v.end())
+    int position;
+    if (name_check_failed(*wrapper, name, statement_wrapper::bulk, position))
     {
-        wrapper->is_ok = false;
-        wrapper->error_message = "Invalid name.";
         return;
     }
 
-    std::vector<indicator> & v = it->second;
+    std::vector<indicator> & v = wrapper->use_indicators_v[position];
     if (index_check_failed(v, *wrapper, index))
     {
         return;
@@ -1607,19 +1516,21 @@ SOCI_DECL void soci_set_use_string_v(statement_handle st,
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_string, statement_wrapper::bulk, "vector string"))
+            name, dt_string, statement_wrapper::bulk, "vector string", position))
     {
         return;
     }
 
-    std::vector<std::string> & v = wrapper->use_strings_v[name];
+    std::vector<std::string> & v =
+        wrapper->use_strings_v[wrapper->use_slots[position]];
     if (index_check_failed(v, *wrapper, index))
     {
         return;
     }
 
-    wrapper->use_indicators_v[name][index] = i_ok;
+    wrapper->use_indicators_v[position][index] = i_ok;
     v[index] = val;
 }
 
@@ -1628,19 +1539,20 @@ SOCI_DECL void soci_set_use_int_v(statement_handle st,
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_integer, statement_wrapper::bulk, "vector int"))
+            name, dt_integer, statement_wrapper::bulk, "vector int", position))
     {
         return;
     }
 
-    std::vector<int> & v = wrapper->use_ints_v[name];
+    std::vector<int> & v = wrapper->use_ints_v[wrapper->use_slots[position]];
     if (index_check_failed(v, *wrapper, index))
     {
         return;
     }
 
-    wrapper->use_indicators_v[name][index] = i_ok;
+    wrapper->use_indicators_v[position][index] = i_ok;
     v[index] = val;
 }
 
@@ -1649,19 +1561,21 @@ SOCI_DECL void soci_set_use_long_long_v(statement_handle st,
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_long_long, statement_wrapper::bulk, "vector long long"))
+            name, dt_long_long, statement_wrapper::bulk, "vector long long", position))
     {
         return;
     }
 
-    std::vector<long long> & v = wrapper->use_longlongs_v[name];
+    std::vector<long long> & v =
+        wrapper->use_longlongs_v[wrapper->use_slots[position]];
     if (index_check_failed(v, *wrapper, index))
     {
         return;
     }
 
-    wrapper->use_indicators_v[name][index] = i_ok;
+    wrapper->use_indicators_v[position][index] = i_ok;
     v[index] = val;
 }
 
@@ -1670,19 +1584,21 @@ SOCI_DECL void soci_set_use_double_v(statement_handle st,
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_double, statement_wrapper::bulk, "vector double"))
+            name, dt_double, statement_wrapper::bulk, "vector double", position))
     {
         return;
     }
 
-    std::vector<double> & v = wrapper->use_doubles_v[name];
+    std::vector<double> & v =
+        wrapper->use_doubles_v[wrapper->use_slots[position]];
     if (index_check_failed(v, *wrapper, index))
     {
         return;
     }
 
-    wrapper->use_indicators_v[name][index] = i_ok;
+    wrapper->use_indicators_v[position][index] = i_ok;
     v[index] = val;
 }
 
@@ -1691,13 +1607,15 @@ SOCI_DECL void soci_set_use_date_v(statement_handle st,
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_date, statement_wrapper::bulk, "vector date"))
+            name, dt_date, statement_wrapper::bulk, "vector date", position))
     {
         return;
     }
 
-    std::vector<std::tm> & v = wrapper->use_dates_v[name];
+    std::vector<std::tm> & v =
+        wrapper->use_dates_v[wrapper->use_slots[position]];
     if (index_check_failed(v, *wrapper, index))
     {
         return;
@@ -1710,109 +1628,214 @@ SOCI_DECL void soci_set_use_date_v(statement_handle st,
         return;
     }
 
-    wrapper->use_indicators_v[name][index] = i_ok;
+    wrapper->use_indicators_v[position][index] = i_ok;
     v[index] = dt;
 }
 
+SOCI_DECL int soci_set_use_states_v(statement_handle st,
+    char const * name, int const * states, int size)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
+
+    int position;
+    if (name_check_failed(*wrapper, name, statement_wrapper::bulk, position) ||
+        size_check_failed(*wrapper, size))
+    {
+        return -1;
+    }
+
+    std::vector<indicator> & v = wrapper->use_indicators_v[position];
+    int const count = size < static_cast<int>(v.size()) ?
+        size : static_cast<int>(v.size());
+    for (int i = 0; i != count; ++i)
+    {
+        v[i] = (states[i] != 0 ? i_ok : i_null);
+    }
+
+    return count;
+}
+
+SOCI_DECL int soci_set_use_strings_v(statement_handle st,
+    char const * name, char const * const * vals, int size)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
+
+    int position;
+    if (name_exists_check_failed(*wrapper,
+            name, dt_string, statement_wrapper::bulk, "vector string", position) ||
+        size_check_failed(*wrapper, size))
+    {
+        return -1;
+    }
+
+    std::vector<std::string> & v =
+        wrapper->use_strings_v[wrapper->use_slots[position]];
+    std::vector<indicator> & ind = wrapper->use_indicators_v[position];
+    int const count = size < static_cast<int>(v.size()) ?
+        size : static_cast<int>(v.size());
+    for (int i = 0; i != count; ++i)
+    {
+        if (vals[i] == NULL)
+        {
+            ind[i] = i_null;
+        }
+        else
+        {
+            ind[i] = i_ok;
+            v[i] = vals[i];
+        }
+    }
+
+    return count;
+}
+
+SOCI_DECL int soci_set_use_ints_v(statement_handle st,
+    char const * name, int const * vals, int size)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
+
+    int position;
+    if (name_exists_check_failed(*wrapper,
+            name, dt_integer, statement_wrapper::bulk, "vector int", position) ||
+        size_check_failed(*wrapper, size))
+    {
+        return -1;
+    }
+
+    return set_use_vector(*wrapper, position,
+        wrapper->use_ints_v[wrapper->use_slots[position]], vals, size);
+}
+
+SOCI_DECL int soci_set_use_long_longs_v(statement_handle st,
+    char const * name, long long const * vals, int size)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
+
+    int position;
+    if (name_exists_check_failed(*wrapper,
+            name, dt_long_long, statement_wrapper::bulk, "vector long long", position) ||
+        size_check_failed(*wrapper, size))
+    {
+        return -1;
+    }
+
+    return set_use_vector(*wrapper, position,
+        wrapper->use_longlongs_v[wrapper->use_slots[position]], vals, size);
+}
+
+SOCI_DECL int soci_set_use_doubles_v(statement_handle st,
+    char const * name, double const * vals, int size)
+{
+    statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
+
+    int position;
+    if (name_exists_check_failed(*wrapper,
+            name, dt_double, statement_wrapper::bulk, "vector double", position) ||
+        size_check_failed(*wrapper, size))
+    {
+        return -1;
+    }
+
+    return set_use_vector(*wrapper, position,
+        wrapper->use_doubles_v[wrapper->use_slots[position]], vals, size);
+}
+
 SOCI_DECL int soci_get_use_state(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
-    typedef std::map<std::string, indicator>::const_iterator iterator;
-    iterator const it = wrapper->use_indicators.find(name);
-    if (it == wrapper->use_indicators.end())
+    int position;
+    if (name_check_failed(*wrapper, name, statement_wrapper::single, position))
     {
-        wrapper->is_ok = false;
-        wrapper->error_message = "Invalid name.";
         return 0;
     }
 
-    wrapper->is_ok = true;
-    return wrapper->use_indicators[name] == i_ok ? 1 : 0;
+    return wrapper->use_indicators[position] == i_ok ? 1 : 0;
 }
 
 SOCI_DECL char const * soci_get_use_string(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_string, statement_wrapper::bulk, "string"))
+            name, dt_string, statement_wrapper::single, "string", position))
     {
         return "";
     }
 
-    return wrapper->use_strings[name].c_str();
+    return wrapper->use_strings[wrapper->use_slots[position]].c_str();
 }
 
 SOCI_DECL int soci_get_use_int(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_integer, statement_wrapper::bulk, "int"))
+            name, dt_integer, statement_wrapper::single, "int", position))
     {
         return 0;
     }
 
-    return wrapper->use_ints[name];
+    return wrapper->use_ints[wrapper->use_slots[position]];
 }
 
 SOCI_DECL long long soci_get_use_long_long(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_long_long, statement_wrapper::bulk, "long long"))
+            name, dt_long_long, statement_wrapper::single, "long long", position))
     {
         return 0LL;
     }
 
-    return wrapper->use_longlongs[name];
+    return wrapper->use_longlongs[wrapper->use_slots[position]];
 }
 
 SOCI_DECL double soci_get_use_double(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_double, statement_wrapper::bulk, "double"))
+            name, dt_double, statement_wrapper::single, "double", position))
     {
         return 0.0;
     }
 
-    return wrapper->use_doubles[name];
+    return wrapper->use_doubles[wrapper->use_slots[position]];
 }
 
 SOCI_DECL char const * soci_get_use_date(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_date, statement_wrapper::bulk, "date"))
+            name, dt_date, statement_wrapper::single, "date", position))
     {
         return "";
     }
 
     // format is: "YYYY MM DD hh mm ss"
-    std::tm const & d = wrapper->use_dates[name];
-    std::sprintf(wrapper->date_formatted, "%d %d %d %d %d %d",
-        d.tm_year + 1900, d.tm_mon + 1, d.tm_mday,
-        d.tm_hour, d.tm_min, d.tm_sec);
-
-    return wrapper->date_formatted;
+    return format_date(*wrapper, wrapper->use_dates[wrapper->use_slots[position]]);
 }
 
 SOCI_DECL blob_handle soci_get_use_blob(statement_handle st, char const * name)
 {
     statement_wrapper * wrapper = static_cast<statement_wrapper *>(st);
 
+    int position;
     if (name_exists_check_failed(*wrapper,
-            name, dt_blob, statement_wrapper::bulk, "blob"))
+            name, dt_blob, statement_wrapper::single, "blob", position))
     {
         return NULL;
     }
 
-    return wrapper->use_blob[name];
+    return wrapper->use_blob[wrapper->use_slots[position]];
 }
 
 SOCI_DECL void soci_prepare(statement_handle st, char const * query)
@@ -1830,32 +1853,28 @@ SOCI_DECL void soci_prepare(statement_handle st, char const * query)
         {
             for (int i = 0; i != into_elements; ++i)
             {
+                int const slot = wrapper->into_slots[i];
+                indicator & ind = wrapper->into_indicators[i];
                 switch (wrapper->into_types[i])
                 {
                 case dt_string:
-                    wrapper->st.exchange(
-                        into(wrapper->into_strings[i], wrapper->into_indicators[i]));
+                    wrapper->st.exchange(into(wrapper->into_strings[slot], ind));
                     break;
                 case dt_integer:
-                    wrapper->st.exchange(
-                        into(wrapper->into_ints[i], wrapper->into_indicators[i]));
+                    wrapper->st.exchange(into(wrapper->into_ints[slot], ind));
                     break;
                 case dt_long_long:
                 case dt_unsigned_long_long:
-                    wrapper->st.exchange(
-                        into(wrapper->into_longlongs[i], wrapper->into_indicators[i]));
+                    wrapper->st.exchange(into(wrapper->into_longlongs[slot], ind));
                     break;
                 case dt_double:
-                    wrapper->st.exchange(
-                        into(wrapper->into_doubles[i], wrapper->into_indicators[i]));
+                    wrapper->st.exchange(into(wrapper->into_doubles[slot], ind));
                     break;
                 case dt_date:
-                    wrapper->st.exchange(
-                        into(wrapper->into_dates[i], wrapper->into_indicators[i]));
+                    wrapper->st.exchange(into(wrapper->into_dates[slot], ind));
                     break;
                 case dt_blob:
-                    wrapper->st.exchange(
-                        into(wrapper->into_blob[i]->blob_, wrapper->into_indicators[i]));
+                    wrapper->st.exchange(into(wrapper->into_blob[slot]->blob_, ind));
                     break;
                 case dt_xml:
                     // no support for xml
@@ -1868,28 +1887,25 @@ SOCI_DECL void soci_prepare(statement_handle st, char const * query)
             // vector elements
             for (int i = 0; i != into_elements; ++i)
             {
+                int const slot = wrapper->into_slots[i];
+                std::vector<indicator> & ind = wrapper->into_indicators_v[i];
                 switch (wrapper->into_types[i])
                 {
                 case dt_string:
-                    wrapper->st.exchange(
-                        into(wrapper->into_strings_v[i], wrapper->into_indicators_v[i]));
+                    wrapper->st.exchange(into(wrapper->into_strings_v[slot], ind));
                     break;
                 case dt_integer:
-                    wrapper->st.exchange(
-                        into(wrapper->into_ints_v[i], wrapper->into_indicators_v[i]));
+                    wrapper->st.exchange(into(wrapper->into_ints_v[slot], ind));
                     break;
                 case dt_long_long:
                 case dt_unsigned_long_long:
-                    wrapper->st.exchange(
-                        into(wrapper->into_longlongs_v[i], wrapper->into_indicators_v[i]));
+                    wrapper->st.exchange(into(wrapper->into_longlongs_v[slot], ind));
                     break;
                 case dt_double:
-                    wrapper->st.exchange(
-                        into(wrapper->into_doubles_v[i], wrapper->into_indicators_v[i]));
+                    wrapper->st.exchange(into(wrapper->into_doubles_v[slot], ind));
                     break;
                 case dt_date:
-                    wrapper->st.exchange(
-                        into(wrapper->into_dates_v[i], wrapper->into_indicators_v[i]));
+                    wrapper->st.exchange(into(wrapper->into_dates_v[slot], ind));
                     break;
                 case dt_blob:
                 case dt_xml:
@@ -1900,159 +1916,73 @@ SOCI_DECL void soci_prepare(statement_handle st, char const * query)
         }
 
         // bind all use elements
-        {
-            // strings
-            typedef std::map<std::string, std::string>::iterator iterator;
-            iterator uit = wrapper->use_strings.begin();
-            iterator const uend = wrapper->use_strings.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                std::string & use_string = uit->second;
-                indicator & use_ind = wrapper->use_indicators[use_name];
-                wrapper->st.exchange(use(use_string, use_ind, use_name));
-            }
-        }
-        {
-            // ints
-            typedef std::map<std::string, int>::iterator iterator;
-            iterator uit = wrapper->use_ints.begin();
-            iterator const uend = wrapper->use_ints.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                int & use_int = uit->second;
-                indicator & use_ind = wrapper->use_indicators[use_name];
-                wrapper->st.exchange(use(use_int, use_ind, use_name));
-            }
-        }
-        {
-            // longlongs
-            typedef std::map<std::string, long long>::iterator iterator;
-            iterator uit = wrapper->use_longlongs.begin();
-            iterator const uend = wrapper->use_longlongs.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                long long & use_longlong = uit->second;
-                indicator & use_ind = wrapper->use_indicators[use_name];
-                wrapper->st.exchange(use(use_longlong, use_ind, use_name));
-            }
-        }
-        {
-            // doubles
-            typedef std::map<std::string, double>::iterator iterator;
-            iterator uit = wrapper->use_doubles.begin();
-            iterator const uend = wrapper->use_doubles.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                double & use_double = uit->second;
-                indicator & use_ind = wrapper->use_indicators[use_name];
-                wrapper->st.exchange(use(use_double, use_ind, use_name));
-            }
-        }
-        {
-            // dates
-            typedef std::map<std::string, std::tm>::iterator iterator;
-            iterator uit = wrapper->use_dates.begin();
-            iterator const uend = wrapper->use_dates.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                std::tm & use_date = uit->second;
-                indicator & use_ind = wrapper->use_indicators[use_name];
-                wrapper->st.exchange(use(use_date, use_ind, use_name));
-            }
-        }
-        {
-            // blobs
-            typedef std::map<std::string, blob_wrapper *>::iterator iterator;
-            iterator uit = wrapper->use_blob.begin();
-            iterator uend = wrapper->use_blob.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                blob &use_blob = uit->second->blob_;
-                indicator & use_ind = wrapper->use_indicators[use_name];
-                wrapper->st.exchange(use(use_blob, use_ind, use_name));
-            }
-        }
 
-        // bind all use vecctor elements
+        int const use_elements = static_cast<int>(wrapper->use_types.size());
+        if (wrapper->use_kind == statement_wrapper::single)
         {
-            // strings
-            typedef std::map<std::string,
-                std::vector<std::string> >::iterator iterator;
-            iterator uit = wrapper->use_strings_v.begin();
-            iterator const uend = wrapper->use_strings_v.end();
-            for ( ; uit != uend; ++uit)
+            for (int i = 0; i != use_elements; ++i)
             {
-                std::string const & use_name = uit->first;
-                std::vector<std::string> & use_string = uit->second;
-                std::vector<indicator> & use_ind =
-                    wrapper->use_indicators_v[use_name];
-                wrapper->st.exchange(use(use_string, use_ind, use_name));
-            }
-        }
-        {
-            // ints
-            typedef std::map<std::string,
-                std::vector<int> >::iterator iterator;
-            iterator uit = wrapper->use_ints_v.begin();
-            iterator const uend = wrapper->use_ints_v.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                std::vector<int> & use_int = uit->second;
-                std::vector<indicator> & use_ind =
-                    wrapper->use_indicators_v[use_name];
-                wrapper->st.exchange(use(use_int, use_ind, use_name));
-            }
-        }
-        {
-            // longlongs
-            typedef std::map<std::string,
-                std::vector<long long> >::iterator iterator;
-            iterator uit = wrapper->use_longlongs_v.begin();
-            iterator const uend = wrapper->use_longlongs_v.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                std::vector<long long> & use_longlong = uit->second;
-                std::vector<indicator> & use_ind =
-                    wrapper->use_indicators_v[use_name];
-                wrapper->st.exchange(use(use_longlong, use_ind, use_name));
-            }
-        }
-        {
-            // doubles
-            typedef std::map<std::string,
-                std::vector<double> >::iterator iterator;
-            iterator uit = wrapper->use_doubles_v.begin();
-            iterator const uend = wrapper->use_doubles_v.end();
-            for ( ; uit != uend; ++uit)
-            {
-                std::string const & use_name = uit->first;
-                std::vector<double> & use_double = uit->second;
-                std::vector<indicator> & use_ind =
-                    wrapper->use_indicators_v[use_name];
-                wrapper->st.exchange(use(use_double, use_ind, use_name));
+                int const slot = wrapper->use_slots[i];
+                std::string const & name = wrapper->use_names[i];
+                indicator & ind = wrapper->use_indicators[i];
+                switch (wrapper->use_types[i])
+                {
+                case dt_string:
+                    wrapper->st.exchange(use(wrapper->use_strings[slot], ind, name));
+                    break;
+                case dt_integer:
+                    wrapper->st.exchange(use(wrapper->use_ints[slot], ind, name));
+                    break;
+                case dt_long_long:
+                case dt_unsigned_long_long:
+                    wrapper->st.exchange(use(wrapper->use_longlongs[slot], ind, name));
+                    break;
+                case dt_double:
+                    wrapper->st.exchange(use(wrapper->use_doubles[slot], ind, name));
+                    break;
+                case dt_date:
+                    wrapper->st.exchange(use(wrapper->use_dates[slot], ind, name));
+                    break;
+                case dt_blob:
+                    wrapper->st.exchange(use(wrapper->use_blob[slot]->blob_, ind, name));
+                    break;
+                case dt_xml:
+                    // no support for xml
+                    break;
+                }
             }
         }
+        else
         {
-            // dates
-            typedef std::map<std::string,
-                std::vector<std::tm> >::iterator iterator;
-            iterator uit = wrapper->use_dates_v.begin();
-            iterator const uend = wrapper->use_dates_v.end();
-            for ( ; uit != uend; ++uit)
+            // vector elements
+            for (int i = 0; i != use_elements; ++i)
             {
-                std::string const & use_name = uit->first;
-                std::vector<std::tm> & use_date = uit->second;
-                std::vector<indicator> & use_ind =
-                    wrapper->use_indicators_v[use_name];
-                wrapper->st.exchange(use(use_date, use_ind, use_name));
+                int const slot = wrapper->use_slots[i];
+                std::string const & name = wrapper->use_names[i];
+                std::vector<indicator> & ind = wrapper->use_indicators_v[i];
+                switch (wrapper->use_types[i])
+                {
+                case dt_string:
+                    wrapper->st.exchange(use(wrapper->use_strings_v[slot], ind, name));
+                    break;
+                case dt_integer:
+                    wrapper->st.exchange(use(wrapper->use_ints_v[slot], ind, name));
+                    break;
+                case dt_long_long:
+                case dt_unsigned_long_long:
+                    wrapper->st.exchange(use(wrapper->use_longlongs_v[slot], ind, name));
+                    break;
+                case dt_double:
+                    wrapper->st.exchange(use(wrapper->use_doubles_v[slot], ind, name));
+                    break;
+                case dt_date:
+                    wrapper->st.exchange(use(wrapper->use_dates_v[slot], ind, name));
+                    break;
+                case dt_blob:
+                case dt_xml:
+                    // no support for bulk blob and xml
+                    break;
+                }
             }
         }
 
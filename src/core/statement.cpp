@@ -7,6 +7,7 @@
 
 #define SOCI_SOURCE
 #include "soci/statement.h"
+#include "soci/result-cache.h"
 #include "soci/session.h"
 #include "soci/into-type.h"
 #include "soci/use-type.h"
@@ -14,22 +15,63 @@
 #include "soci-compiler.h"
 #include <ctime>
 #include <cctype>
+#include <cstring>
 
 using namespace soci;
 using namespace soci::details;
 
+namespace
+{
+
+// Return true if the query starts with a DDL keyword, i.e. may change the
+// columns returned by the other queries.
+bool is_schema_change(std::string const & query)
+{
+    std::string::const_iterator it = query.begin();
+    while (it != query.end() && std::isspace(static_cast<unsigned char>(*it)))
+    {
+        ++it;
+    }
+
+    char keyword[7];
+    std::size_t len = 0;
+    for (; it != query.end() && std::isalpha(static_cast<unsigned char>(*it)); ++it)
+    {
+        if (len == sizeof(keyword) - 1)
+        {
+            // longer than any of the keywords checked for below
+            return false;
+        }
+
+        keyword[len++] = static_cast<char>(std::tolower(static_cast<unsigned char>(*it)));
+    }
+    keyword[len] = '\0';
+
+    return std::strcmp(keyword, "create") == 0 ||
+           std::strcmp(keyword, "alter") == 0 ||
+           std::strcmp(keyword, "drop") == 0 ||
+           std::strcmp(keyword, "rename") == 0;
+}
+
+} // namespace anonymous
+
 
 statement_impl::statement_impl(session & s)
-    : session_(s), refCount_(1), row_(0),
+    : session_(s), refCount_(1), row_(0), batch_(0),
       fetchSize_(1), initialFetchSize_(1),
-      alreadyDescribed_(false)
+      oneTimeQuery_(false), cacheResults_(false), cacheTimeToLive_(-1),
+      executeStarted_(false), alreadyDescribed_(false), schemaChange_(false)
 {
     backEnd_ = s.make_statement_backend();
+
+    session_.register_statement(this);
 }
 
 statement_impl::statement_impl(prepare_temp_type const & prep)
     : session_(prep.get_prepare_info()->session_),
-      refCount_(1), row_(0), fetchSize_(1), alreadyDescribed_(false)
+      refCount_(1), row_(0), batch_(0), fetchSize_(1),
+      oneTimeQuery_(false), cacheResults_(false), cacheTimeToLive_(-1),
+      executeStarted_(false), alreadyDescribed_(false), schemaChange_(false)
 {
     backEnd_ = session_.make_statement_backend();
 
@@ -43,10 +85,9 @@ statement_impl::statement_impl(prepare_temp_type const & prep)
     alloc();
 
     // prepare the statement
-    query_ = prepInfo->get_query();
     try
     {
-        prepare(query_);
+        prepare(prepInfo->get_query());
     }
     catch(...)
     {
@@ -55,10 +96,14 @@ statement_impl::statement_impl(prepare_temp_type const & prep)
     }
 
     define_and_bind();
+
+    session_.register_statement(this);
 }
 
 statement_impl::~statement_impl()
 {
+    session_.unregister_statement(this);
+
     clean_up();
 }
 
@@ -81,76 +126,82 @@ void statement_impl::bind(values & values)
             // - or positional
 
             std::string const& useName = (*it)->get_name();
-            if (useName.empty())
+            if (useName.empty() || has_placeholder(useName))
             {
-                // positional use element
-
                 int position = static_cast<int>(uses_.size());
                 (*it)->bind(*this, position);
                 uses_.push_back(*it);
-                indicators_.push_back(values.indicators_[cnt]);
-            }
-            else
-            {
-                // named use element - check if it is used
-                std::string const placeholder = ":" + useName;
-
-                std::size_t pos = query_.find(placeholder);
-                while (pos != std::string::npos)
-                {
-                    // Retrieve next char after placeholder
-                    // make sure we do not go out of range on the string
-                    const char nextChar = (pos + placeholder.size()) < query_.size() ?
-                                          query_[pos + placeholder.size()] : '\0';
-
-                    if (std::isalnum(nextChar))
-                    {
-                        // We got a partial match only,
-                        // keep looking for the placeholder
-                        pos = query_.find(placeholder, pos + placeholder.size());
-                    }
-                    else
-                    {
-                        int position = static_cast<int>(uses_.size());
-                        (*it)->bind(*this, position);
-                        uses_.push_back(*it);
-                        indicators_.push_back(values.indicators_[cnt]);
-                        // Ok we found it, done
-                        break;
-                    }
-                }
-                // In case we couldn't find the placeholder
-                if (pos == std::string::npos)
-                {
-                    values.add_unused(*it, values.indicators_[cnt]);
-                }
+                values.set_bound(cnt);
             }
 
             cnt++;
         }
+
+        values.set_bound_to_statement();
     }
     catch (...)
     {
-        for (std::size_t i = ++cnt; i != values.uses_.size(); ++i)
+        // the elements which were not bound remain owned by values
+        rethrow_current_exception_with_context("binding parameters of");
+    }
+}
+
+void statement_impl::bind(values_batch & batch)
+{
+    try
+    {
+        std::size_t const columns = batch.get_number_of_columns();
+        for (std::size_t i = 0; i != columns; ++i)
         {
-            values.add_unused(values.uses_[i], values.indicators_[i]);
-        }
+            // the same rules as in bind(values) above apply here
+            std::string const& useName = batch.get_name(i);
+            if (useName.empty() || has_placeholder(useName))
+            {
+                use_type_ptr u(batch.get_column(i).make_use(useName));
 
+                int position = static_cast<int>(uses_.size());
+                u.get()->bind(*this, position);
+                uses_.exchange(u);
+            }
+        }
+    }
+    catch (...)
+    {
         rethrow_current_exception_with_context("binding parameters of");
     }
 }
 
-void statement_impl::bind_clean_up()
+bool statement_impl::has_placeholder(std::string const & name) const
 {
-    // deallocate all bind and define objects
-    std::size_t const isize = intos_.size();
-    for (std::size_t i = isize; i != 0; --i)
+    std::string const placeholder = ":" + name;
+    std::string const & query = query_.str();
+
+    std::size_t pos = query.find(placeholder);
+    while (pos != std::string::npos)
     {
-        intos_[i - 1]->clean_up();
-        delete intos_[i - 1];
-        intos_.resize(i - 1);
+        // Retrieve next char after placeholder
+        // make sure we do not go out of range on the string
+        const char nextChar = (pos + placeholder.size()) < query.size() ?
+                              query[pos + placeholder.size()] : '\0';
+
+        if (std::isalnum(nextChar) == false)
+        {
+            // Ok we found it, done
+            return true;
+        }
+
+        // We got a partial match only,
+        // keep looking for the placeholder
+        pos = query.find(placeholder, pos + placeholder.size());
     }
 
+    return false;
+}
+
+void statement_impl::bind_clean_up()
+{
+    // deallocate all bind and define objects, starting with the implicit
+    // into elements as they may refer to the data owned by the explicit ones
     std::size_t const ifrsize = intosForRow_.size();
     for (std::size_t i = ifrsize; i != 0; --i)
     {
@@ -159,6 +210,14 @@ void statement_impl::bind_clean_up()
         intosForRow_.resize(i - 1);
     }
 
+    std::size_t const isize = intos_.size();
+    for (std::size_t i = isize; i != 0; --i)
+    {
+        intos_[i - 1]->clean_up();
+        delete intos_[i - 1];
+        intos_.resize(i - 1);
+    }
+
     std::size_t const usize = uses_.size();
     for (std::size_t i = usize; i != 0; --i)
     {
@@ -167,14 +226,8 @@ void statement_impl::bind_clean_up()
         uses_.resize(i - 1);
     }
 
-    std::size_t const indsize = indicators_.size();
-    for (std::size_t i = 0; i != indsize; ++i)
-    {
-        delete indicators_[i];
-        indicators_[i] = NULL;
-    }
-
     row_ = NULL;
+    batch_ = NULL;
     alreadyDescribed_ = false;
 }
 
@@ -189,18 +242,101 @@ void statement_impl::clean_up()
     }
 }
 
+void statement_impl::release_backend()
+{
+    // release the implicit into elements first, as in bind_clean_up()
+    std::size_t const ifrsize = intosForRow_.size();
+    for (std::size_t i = ifrsize; i != 0; --i)
+    {
+        intosForRow_[i - 1]->release_backend();
+    }
+
+    std::size_t const isize = intos_.size();
+    for (std::size_t i = isize; i != 0; --i)
+    {
+        intos_[i - 1]->release_backend();
+    }
+
+    std::size_t const usize = uses_.size();
+    for (std::size_t i = usize; i != 0; --i)
+    {
+        uses_[i - 1]->release_backend();
+    }
+
+    if (backEnd_ != NULL)
+    {
+        backEnd_->clean_up();
+        delete backEnd_;
+        backEnd_ = NULL;
+    }
+}
+
+void statement_impl::restore_backend()
+{
+    backEnd_ = session_.make_statement_backend();
+    backEnd_->alloc();
+
+    if (query_.empty())
+    {
+        // nothing else to do for a statement which wasn't prepared yet
+        return;
+    }
+
+    try
+    {
+        backEnd_->prepare(query_.str(),
+            oneTimeQuery_ ? st_one_time_query : st_repeatable_query);
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("preparing");
+    }
+
+    // the implicit elements created for the row or batch are defined at the
+    // same positions as before, as the result columns didn't change
+    int definePosition = 1;
+    std::size_t const isize = intos_.size();
+    for (std::size_t i = 0; i != isize; ++i)
+    {
+        intos_[i]->redefine(*this, definePosition);
+    }
+
+    definePosition = definePositionForRow_;
+    std::size_t const ifrsize = intosForRow_.size();
+    for (std::size_t i = 0; i != ifrsize; ++i)
+    {
+        intosForRow_[i]->redefine(*this, definePosition);
+    }
+
+    int bindPosition = 1;
+    std::size_t const usize = uses_.size();
+    for (std::size_t i = 0; i != usize; ++i)
+    {
+        uses_[i]->rebind(*this, bindPosition);
+    }
+}
+
 void statement_impl::prepare(std::string const & query,
     statement_type eType)
 {
     try
     {
-        query_ = query;
-        session_.log_query(query);
+        // the session returns the same shared text if the same query was
+        // already prepared recently, avoiding copying it
+        query_ = session_.intern_query(query);
+        oneTimeQuery_ = eType == st_one_time_query;
+        session_.log_query(query_.str());
+
+        // checked only once here rather than every time it's executed
+        schemaChange_ = is_schema_change(query_.str());
 
         backEnd_->prepare(query, eType);
     }
     catch (...)
     {
+        // see the comment in execute()
+        session_.clear_column_descriptions();
+
         rethrow_current_exception_with_context("preparing");
     }
 }
@@ -260,6 +396,9 @@ void statement_impl::undefine_and_bind()
 
 bool statement_impl::execute(bool withDataExchange)
 {
+    // set once the statement becomes part of the group commit batch
+    bool groupCommitStarted = false;
+
     try
     {
         initialFetchSize_ = intos_size();
@@ -274,9 +413,21 @@ bool statement_impl::execute(bool withDataExchange)
         fetchSize_ = initialFetchSize_;
 
         // pre-use should be executed before inspecting the sizes of use
-        // elements, as they can be resized in type conversion routines
+        // elements, as they can be resized in type conversion routines, and
+        // was already done if the execution was started asynchronously
 
-        pre_use();
+        bool const wasStarted = executeStarted_;
+        if (executeStarted_)
+        {
+            executeStarted_ = false;
+
+            // start_execute() already added it to the batch
+            groupCommitStarted = uses_group_commit();
+        }
+        else
+        {
+            pre_use();
+        }
 
         std::size_t const bindSize = uses_size();
 
@@ -286,17 +437,39 @@ bool statement_impl::execute(bool withDataExchange)
                  "Bulk insert/update and bulk select not allowed in same query");
         }
 
+        // the results of the queries executed once may be cached, in which
+        // case the database is not accessed at all on cache hit
+        std::string cacheKey;
+        result_cache * const cache =
+            withDataExchange ? get_result_cache(cacheKey) : NULL;
+        if (cache != NULL)
+        {
+            bool gotData;
+            if (load_from_cache(*cache, cacheKey, gotData))
+            {
+                post_use(gotData);
+
+                session_.set_got_data(gotData);
+                return gotData;
+            }
+        }
+
         // looks like a hack and it is - row description should happen
         // *after* the use elements were completely prepared
         // and *before* the into elements are touched, so that the row
         // description process can inject more into elements for
         // implicit data exchange
-        if (row_ != NULL && alreadyDescribed_ == false)
+        if ((row_ != NULL || batch_ != NULL) && alreadyDescribed_ == false)
         {
             describe();
             define_for_row();
         }
 
+        if (batch_ != NULL)
+        {
+            resize_intos_for_row(fetchSize_);
+        }
+
         int num = 0;
         if (withDataExchange)
         {
@@ -313,11 +486,22 @@ bool statement_impl::execute(bool withDataExchange)
                 num = static_cast<int>(bindSize);
             }
         }
-        
+
+        if (wasStarted == false && uses_group_commit())
+        {
+            groupCommitStarted = true;
+            session_.group_commit_pre_execute();
+        }
+
         pre_exec(num);
 
         statement_backend::exec_fetch_result res = backEnd_->execute(num);
 
+        if (schemaChange_)
+        {
+            session_.clear_column_descriptions();
+        }
+
         bool gotData = false;
 
         if (res == statement_backend::ef_success)
@@ -349,15 +533,215 @@ bool statement_impl::execute(bool withDataExchange)
 
         post_use(gotData);
 
+        if (cache != NULL)
+        {
+            store_in_cache(*cache, cacheKey, gotData);
+        }
+
+        if (groupCommitStarted)
+        {
+            session_.group_commit_post_execute(true);
+        }
+
         session_.set_got_data(gotData);
         return gotData;
     }
     catch (...)
     {
+        // the error may be due to the schema having changed behind our back,
+        // so don't trust the remembered descriptions any more
+        session_.clear_column_descriptions();
+
+        if (groupCommitStarted)
+        {
+            session_.group_commit_post_execute(false);
+        }
+
         rethrow_current_exception_with_context("executing");
     }
 }
 
+bool statement_impl::uses_group_commit() const
+{
+    return intos_.empty() && row_ == NULL && batch_ == NULL;
+}
+
+int statement_impl::start_execute()
+{
+    if (executeStarted_)
+    {
+        throw soci_error("Statement execution was already started.");
+    }
+
+    // the cached results are retrieved without accessing the database
+    if (cacheResults_)
+    {
+        return -1;
+    }
+
+    bool groupCommitStarted = false;
+
+    try
+    {
+        pre_use();
+        executeStarted_ = true;
+
+        // use the same number of rows as execute(true) would
+        int num = 1;
+        std::size_t const isize = intos_size();
+        if (static_cast<int>(isize) > num)
+        {
+            num = static_cast<int>(isize);
+        }
+        std::size_t const bindSize = uses_size();
+        if (static_cast<int>(bindSize) > num)
+        {
+            num = static_cast<int>(bindSize);
+        }
+
+        if (uses_group_commit())
+        {
+            groupCommitStarted = true;
+            session_.group_commit_pre_execute();
+        }
+
+        // pre_exec() is still called by execute() as the backends may
+        // allocate resources in it
+        return backEnd_->start_execute(num);
+    }
+    catch (...)
+    {
+        if (executeStarted_)
+        {
+            executeStarted_ = false;
+            post_use(false);
+        }
+
+        if (groupCommitStarted)
+        {
+            session_.group_commit_post_execute(false);
+        }
+
+        rethrow_current_exception_with_context("starting to execute");
+    }
+}
+
+bool statement_impl::is_result_pending()
+{
+    try
+    {
+        return backEnd_->is_result_pending();
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("waiting for the result of");
+    }
+}
+
+void statement_impl::cache_results(int timeToLive)
+{
+    cacheResults_ = true;
+    cacheTimeToLive_ = timeToLive;
+}
+
+result_cache * statement_impl::get_result_cache(std::string & key)
+{
+    if (cacheResults_ == false)
+    {
+        return NULL;
+    }
+
+    result_cache * const cache = session_.get_result_cache();
+    if (cache == NULL)
+    {
+        throw soci_error("No result cache is associated with the session.");
+    }
+
+    // only the single row results fetched into the explicitly given elements
+    // are cached, as the others could be too big
+    if (row_ != NULL || batch_ != NULL || intos_.empty() || fetchSize_ != 1)
+    {
+        return NULL;
+    }
+
+    // the query must be followed by a character which can't occur in it, see
+    // result_cache::invalidate()
+    key = query_.str();
+    key += '\0';
+
+    std::size_t const usize = uses_.size();
+    for (std::size_t i = 0; i != usize; ++i)
+    {
+        if (uses_[i]->append_cache_key(key) == false)
+        {
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
+bool statement_impl::load_from_cache(result_cache & cache,
+    std::string const & key, bool & gotData)
+{
+    bool const hit = load_cached_values(cache, key, gotData);
+
+    // only count the hit if the cached values could really be used
+    cache.record_lookup(hit);
+
+    return hit;
+}
+
+bool statement_impl::load_cached_values(result_cache & cache,
+    std::string const & key, bool & gotData)
+{
+    std::vector<cached_value> values;
+    if (cache.find(key, gotData, values) == false)
+    {
+        return false;
+    }
+
+    if (gotData)
+    {
+        std::size_t const isize = intos_.size();
+        if (values.size() != isize)
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i != isize; ++i)
+        {
+            if (intos_[i]->load_from_cache(values[i]) == false)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void statement_impl::store_in_cache(result_cache & cache,
+    std::string const & key, bool gotData)
+{
+    std::vector<cached_value> values;
+
+    if (gotData)
+    {
+        std::size_t const isize = intos_.size();
+        values.resize(isize);
+        for (std::size_t i = 0; i != isize; ++i)
+        {
+            if (intos_[i]->save_to_cache(values[i]) == false)
+            {
+                return;
+            }
+        }
+    }
+
+    cache.store(key, gotData, values, cacheTimeToLive_);
+}
+
 long long statement_impl::get_affected_rows()
 {
     try
@@ -404,6 +788,11 @@ bool statement_impl::fetch()
             fetchSize_ = newFetchSize;
         }
 
+        if (batch_ != NULL)
+        {
+            resize_intos_for_row(fetchSize_);
+        }
+
         statement_backend::exec_fetch_result const res = backEnd_->fetch(static_cast<int>(fetchSize_));
         if (res == statement_backend::ef_success)
         {
@@ -501,9 +890,6 @@ std::size_t statement_impl::uses_size()
 
 bool statement_impl::resize_intos(std::size_t upperBound)
 {
-    // this function does not need to take into account the intosForRow_
-    // elements, since they are never used for bulk operations
-
     int rows = backEnd_->get_number_of_rows();
     if (rows < 0)
     {
@@ -520,6 +906,8 @@ bool statement_impl::resize_intos(std::size_t upperBound)
         intos_[i]->resize((std::size_t)rows);
     }
 
+    resize_intos_for_row((std::size_t)rows);
+
     return rows > 0 ? true : false;
 }
 
@@ -530,6 +918,19 @@ void statement_impl::truncate_intos()
     {
         intos_[i]->resize(0);
     }
+
+    resize_intos_for_row(0);
+}
+
+void statement_impl::resize_intos_for_row(std::size_t sz)
+{
+    // this only affects the vector elements injected by the description of
+    // a batch of values, the ones used for a single row are not resizeable
+    std::size_t const ifrsize = intosForRow_.size();
+    for (std::size_t i = 0; i != ifrsize; ++i)
+    {
+        intosForRow_[i]->resize(sz);
+    }
 }
 
 void statement_impl::pre_exec(int num)
@@ -665,19 +1066,63 @@ void statement_impl::bind_into<dt_date>()
 
 void statement_impl::describe()
 {
-    row_->clean_up();
+    if (row_ != NULL)
+    {
+        row_->clean_up();
+    }
+    if (batch_ != NULL)
+    {
+        batch_->clean_up();
+    }
 
-    int const numcols = backEnd_->prepare_for_describe();
-    for (int i = 1; i <= numcols; ++i)
+    // the session remembers the description of the recently executed
+    // queries, so that the backend needs to describe each of them only once,
+    // unless the column types it reports may depend on the data
+    bool const reusable = backEnd_->has_data_independent_types();
+    std::vector<column_properties> const * columns =
+        reusable ? session_.get_column_descriptions(query_) : NULL;
+    if (columns == NULL)
     {
-        data_type dtype;
-        std::string columnName;
+        bool const uppercaseColumnNames = session_.get_uppercase_column_names();
+
+        int const numcols = backEnd_->prepare_for_describe();
+        columnsDescription_.resize(numcols);
+        for (int i = 1; i <= numcols; ++i)
+        {
+            data_type dtype;
+            std::string columnName;
 
-        backEnd_->describe_column(i, dtype, columnName);
+            backEnd_->describe_column(i, dtype, columnName);
 
-        column_properties props;
-        props.set_name(columnName);
-        props.set_data_type(dtype);
+            if (uppercaseColumnNames)
+            {
+                for (std::size_t n = 0; n != columnName.size(); ++n)
+                {
+                    columnName[n] = static_cast<char>(std::toupper(columnName[n]));
+                }
+            }
+
+            column_properties & props = columnsDescription_[i - 1];
+            props.set_name(columnName);
+            props.set_data_type(dtype);
+        }
+
+        columns = reusable
+            ? &session_.set_column_descriptions(query_, columnsDescription_)
+            : &columnsDescription_;
+    }
+
+    std::size_t const numcols = columns->size();
+    for (std::size_t i = 0; i != numcols; ++i)
+    {
+        column_properties const & props = (*columns)[i];
+        data_type const dtype = props.get_data_type();
+
+        if (batch_ != NULL)
+        {
+            bind_into_batch(dtype, props.get_name());
+            continue;
+        }
 
         switch (dtype)
         {
@@ -711,12 +1156,50 @@ void statement_impl::describe()
     alreadyDescribed_ = true;
 }
 
+void statement_impl::bind_into_batch(data_type dtype, std::string const & name)
+{
+    values_column_factory factory;
+    switch (dtype)
+    {
+    case dt_string:
+        factory = &values_column<std::string>::make;
+        break;
+    case dt_double:
+        factory = &values_column<double>::make;
+        break;
+    case dt_integer:
+        factory = &values_column<int>::make;
+        break;
+    case dt_long_long:
+        factory = &values_column<long long>::make;
+        break;
+    case dt_unsigned_long_long:
+        factory = &values_column<unsigned long long>::make;
+        break;
+    case dt_date:
+        factory = &values_column<std::tm>::make;
+        break;
+    default:
+        std::ostringstream msg;
+        msg << "db column type " << dtype
+            <<" not supported for dynamic selects"<<std::endl;
+        throw soci_error(msg.str());
+    }
+
+    batch_->add_column(factory, name);
+
+    std::size_t const pos = batch_->get_number_of_columns() - 1;
+    values_column_base & column = batch_->get_column(pos);
+    column.resize(fetchSize_);
+    exchange_for_row(into_type_ptr(column.make_into()));
+}
+
 } // namespace details
 } // namespace soci
 
 void statement_impl::set_row(row * r)
 {
-    if (row_ != NULL)
+    if (row_ != NULL || batch_ != NULL)
     {
         throw soci_error(
             "Only one Row element allowed in a single statement.");
@@ -726,6 +1209,17 @@ void statement_impl::set_row(row * r)
     row_->uppercase_column_names(session_.get_uppercase_column_names());
 }
 
+void statement_impl::set_values_batch(values_batch * batch)
+{
+    if (row_ != NULL || batch_ != NULL)
+    {
+        throw soci_error(
+            "Only one Row element allowed in a single statement.");
+    }
+
+    batch_ = batch;
+}
+
 std::string statement_impl::rewrite_for_procedure_call(std::string const & query)
 {
     return backEnd_->rewrite_for_procedure_call(query);
@@ -780,7 +1274,7 @@ statement_impl::rethrow_current_exception_with_context(char const* operation)
         if (!query_.empty())
         {
             std::ostringstream oss;
-            oss << "while " << operation << " \"" << query_ << "\"";
+            oss << "while " << operation << " \"" << query_.str() << "\"";
 
             if (!uses_.empty())
             {
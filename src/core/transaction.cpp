@@ -8,13 +8,26 @@
 #define SOCI_SOURCE
 #include "soci/transaction.h"
 #include "soci/error.h"
+#include <sstream>
 
 using namespace soci;
 
 transaction::transaction(session& sql)
     : handled_(false), sql_(sql)
 {
-    sql_.begin();
+    if (sql_.is_in_transaction())
+    {
+        std::ostringstream oss;
+        oss << "soci_savepoint_" << sql_.nestedTransactions_ + 1;
+        savepoint_ = oss.str();
+
+        sql_.savepoint(savepoint_);
+        ++sql_.nestedTransactions_;
+    }
+    else
+    {
+        sql_.begin();
+    }
 }
 
 transaction::~transaction()
@@ -37,8 +50,20 @@ void transaction::commit()
         throw soci_error("The transaction object cannot be handled twice.");
     }
 
-    sql_.commit();
-    handled_ = true;
+    if (is_nested())
+    {
+        // Handle it first as, if releasing the savepoint fails, there is
+        // nothing more to do with it anyhow.
+        handle();
+
+        sql_.release_savepoint(savepoint_);
+    }
+    else
+    {
+        sql_.commit();
+
+        handle();
+    }
 }
 
 void transaction::rollback()
@@ -48,6 +73,33 @@ void transaction::rollback()
         throw soci_error("The transaction object cannot be handled twice.");
     }
 
-    sql_.rollback();
+    if (is_nested())
+    {
+        // As in commit(), and also avoids rolling back again from the
+        // destructor if this fails.
+        handle();
+
+        // The savepoint remains after rolling back to it, so release it
+        // too to allow reusing its name for the next nested transaction.
+        sql_.rollback_to_savepoint(savepoint_);
+        sql_.release_savepoint(savepoint_);
+    }
+    else
+    {
+        sql_.rollback();
+
+        handle();
+    }
+}
+
+void transaction::handle()
+{
+    // The counter is reset when the outermost transaction ends, possibly
+    // while the nested transaction objects are still alive.
+    if (is_nested() && sql_.nestedTransactions_ != 0)
+    {
+        --sql_.nestedTransactions_;
+    }
+
     handled_ = true;
 }
@@ -10,6 +10,8 @@
 #include "soci/use-type.h"
 #include "soci/statement.h"
 #include "soci-exchange-cast.h"
+#include "soci-decimal.h"
+#include "soci-mktime.h"
 
 #include <cstdio>
 
@@ -109,6 +111,35 @@ void standard_use_type::dump_value(std::ostream& os) const
         case x_longstring:
             os << "<long string>";
             return;
+
+        case x_stringref:
+            {
+                string_ref const& s = exchange_type_cast<x_stringref>(data_);
+                os << "\"" << s.to_string() << "\"";
+            }
+            return;
+
+        case x_timestamp:
+            {
+                char buf[timestamp_buffer_size];
+                format_timestamp(buf, exchange_type_cast<x_timestamp>(data_));
+
+                os << buf;
+            }
+            return;
+
+        case x_decimal:
+            {
+                char buf[decimal_buffer_size];
+                format_decimal(buf, exchange_type_cast<x_decimal>(data_));
+
+                os << buf;
+            }
+            return;
+
+        case x_packedstrings:
+            // Only used with vector_use_type, can't happen here.
+            break;
     }
 
     // This is normally unreachable, but avoid throwing from here as we're
@@ -116,6 +147,131 @@ void standard_use_type::dump_value(std::ostream& os) const
     os << "<unknown>";
 }
 
+namespace // anonymous
+{
+
+// Append the raw representation of the value, which is unambiguous as its
+// size is fixed.
+template <typename T>
+void append_raw(std::string & key, T const & value)
+{
+    key.append(reinterpret_cast<char const *>(&value), sizeof(value));
+}
+
+// Append the string prefixed by its length to avoid ambiguities between,
+// e.g., the values "a", "bc" and "ab", "c" of two consecutive parameters.
+void append_string(std::string & key, char const * s, std::size_t len)
+{
+    append_raw(key, len);
+    if (len != 0)
+        key.append(s, len);
+}
+
+} // namespace anonymous
+
+bool standard_use_type::append_cache_key(std::string & key) const
+{
+    if (ind_ && *ind_ == i_null)
+    {
+        key += 'N';
+        return true;
+    }
+
+    // Prefix the value with its type, as the same bytes could correspond to
+    // different values of different types.
+    key += static_cast<char>('a' + type_);
+
+    switch (type_)
+    {
+        case x_char:
+            key += exchange_type_cast<x_char>(data_);
+            return true;
+
+        case x_stdstring:
+            {
+                std::string const& s = exchange_type_cast<x_stdstring>(data_);
+                append_string(key, s.data(), s.size());
+            }
+            return true;
+
+        case x_short:
+            append_raw(key, exchange_type_cast<x_short>(data_));
+            return true;
+
+        case x_integer:
+            append_raw(key, exchange_type_cast<x_integer>(data_));
+            return true;
+
+        case x_long_long:
+            append_raw(key, exchange_type_cast<x_long_long>(data_));
+            return true;
+
+        case x_unsigned_long_long:
+            append_raw(key, exchange_type_cast<x_unsigned_long_long>(data_));
+            return true;
+
+        case x_double:
+            append_raw(key, exchange_type_cast<x_double>(data_));
+            return true;
+
+        case x_stdtm:
+            {
+                std::tm const& t = exchange_type_cast<x_stdtm>(data_);
+                append_raw(key, t.tm_year);
+                append_raw(key, t.tm_mon);
+                append_raw(key, t.tm_mday);
+                append_raw(key, t.tm_hour);
+                append_raw(key, t.tm_min);
+                append_raw(key, t.tm_sec);
+            }
+            return true;
+
+        case x_xmltype:
+            {
+                std::string const& s = exchange_type_cast<x_xmltype>(data_).value;
+                append_string(key, s.data(), s.size());
+            }
+            return true;
+
+        case x_longstring:
+            {
+                std::string const& s =
+                    exchange_type_cast<x_longstring>(data_).value;
+                append_string(key, s.data(), s.size());
+            }
+            return true;
+
+        case x_stringref:
+            {
+                string_ref const& s = exchange_type_cast<x_stringref>(data_);
+                append_string(key, s.data, s.length);
+            }
+            return true;
+
+        case x_timestamp:
+            append_raw(key, exchange_type_cast<x_timestamp>(data_).microseconds);
+            return true;
+
+        case x_decimal:
+            {
+                decimal const& d = exchange_type_cast<x_decimal>(data_);
+                append_raw(key, d.value);
+                append_raw(key, d.scale);
+            }
+            return true;
+
+        case x_statement:
+        case x_rowid:
+        case x_blob:
+        case x_packedstrings:
+            // These values can't be compared, so queries using them are
+            // never cached.
+            break;
+    }
+
+    return false;
+}
+
 void standard_use_type::pre_exec(int num)
 {
     backEnd_->pre_exec(num);
@@ -143,6 +299,16 @@ void standard_use_type::post_use(bool gotData)
     // See conversion_use_type<T>::convert_from_base() for more details.
 }
 
+void standard_use_type::release_backend()
+{
+    if (backEnd_ != NULL)
+    {
+        backEnd_->clean_up();
+        delete backEnd_;
+        backEnd_ = NULL;
+    }
+}
+
 void standard_use_type::clean_up()
 {
     if (backEnd_ != NULL)
@@ -156,6 +322,16 @@ vector_use_type::~vector_use_type()
     delete backEnd_;
 }
 
+void vector_use_type::release_backend()
+{
+    if (backEnd_ != NULL)
+    {
+        backEnd_->clean_up();
+        delete backEnd_;
+        backEnd_ = NULL;
+    }
+}
+
 void vector_use_type::bind(statement_impl & st, int & position)
 {
     if (backEnd_ == NULL)
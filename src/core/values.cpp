@@ -10,7 +10,6 @@
 #include "soci/row.h"
 
 #include <cstddef>
-#include <map>
 #include <sstream>
 #include <string>
 
@@ -37,14 +36,14 @@ indicator values::get_indicator(std::string const& name) const
     }
     else
     {
-        std::map<std::string, std::size_t>::const_iterator it = index_.find(name);
-        if (it == index_.end())
+        std::size_t const pos = find_use(name);
+        if (pos == uses_.size())
         {
             std::ostringstream msg;
             msg << "Column '" << name << "' not found";
             throw soci_error(msg.str());
         }
-        return *indicators_[it->second];
+        return *indicators_[pos];
     }
 }
 
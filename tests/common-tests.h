@@ -97,6 +97,11 @@ struct PhonebookEntry2 : public PhonebookEntry
 {
 };
 
+// Same as PhonebookEntry but converted using positional values
+struct PhonebookEntry4 : public PhonebookEntry
+{
+};
+
 class PhonebookEntry3
 {
 public:
@@ -208,6 +213,23 @@ template<> struct type_conversion<PhonebookEntry3>
     }
 };
 
+// type conversion using positional values only
+template<> struct type_conversion<PhonebookEntry4>
+{
+    typedef soci::values base_type;
+
+    static void from_base(values const &v, indicator /* ind */, PhonebookEntry4 &pe)
+    {
+        v >> pe.name >> pe.phone;
+    }
+
+    static void to_base(PhonebookEntry4 const &pe, values &v, indicator &ind)
+    {
+        v << pe.name << pe.phone;
+        ind = i_ok;
+    }
+};
+
 } // namespace soci
 
 namespace soci
@@ -592,6 +614,37 @@ TEST_CASE_METHOD(common_tests, "Use and into", "[core][into]")
         CHECK(str == "Hello, SOCI!");
     }
 
+    SECTION("Round trip works for string references")
+    {
+        // the referenced strings don't need to be NUL-terminated
+        char const hello[] = "Hello, SOCI! Goodbye, SOCI!";
+        string_ref const first(hello, 12);
+        sql << "insert into soci_test(id, str) values(1, :s)", use(first);
+        string_ref const second(hello + 13, 14);
+        sql << "insert into soci_test(id, str) values(2, :s)", use(second);
+        sql << "insert into soci_test(id, str) values(3, NULL)";
+
+        // the fetched references remain valid until the next fetch only
+        string_ref ref;
+        indicator ind;
+        statement st = (sql.prepare <<
+            "select str from soci_test order by id", into(ref, ind));
+        st.execute();
+
+        REQUIRE(st.fetch());
+        CHECK(ind == i_ok);
+        CHECK(ref.to_string() == "Hello, SOCI!");
+
+        REQUIRE(st.fetch());
+        CHECK(ind == i_ok);
+        CHECK(ref.to_string() == "Goodbye, SOCI!");
+
+        REQUIRE(st.fetch());
+        CHECK(ind == i_null);
+
+        CHECK(!st.fetch());
+    }
+
     SECTION("Round trip works for short")
     {
         short three(3);
@@ -1633,6 +1686,53 @@ TEST_CASE_METHOD(common_tests, "Use vector", "[core][use][vector]")
         CHECK(v2[2] == "ma");
     }
 
+    SECTION("packed_strings")
+    {
+        std::vector<int> ids;
+        packed_strings v;
+        std::vector<indicator> inds;
+        ids.push_back(1);
+        v.push_back("ala");
+        inds.push_back(i_ok);
+        ids.push_back(2);
+        v.push_back("ma");
+        inds.push_back(i_ok);
+        ids.push_back(3);
+        v.push_back("kota");
+        inds.push_back(i_ok);
+        ids.push_back(4);
+        v.push_back(std::string());
+        inds.push_back(i_null);
+
+        sql << "insert into soci_test(id, str) values(:i, :s)",
+            use(ids), use(v, inds);
+
+        packed_strings v2;
+        v2.resize(2);
+        std::vector<indicator> inds2(2);
+
+        statement st = (sql.prepare <<
+            "select str from soci_test order by id", into(v2, inds2));
+
+        REQUIRE(st.execute(true));
+        REQUIRE(v2.size() == 2);
+        CHECK(inds2[0] == i_ok);
+        CHECK(v2.str(0) == "ala");
+        CHECK(inds2[1] == i_ok);
+        CHECK(v2[1].to_string() == "ma");
+
+        // the buffer is reused for the next batch
+        REQUIRE(st.fetch());
+        REQUIRE(v2.size() == 2);
+        CHECK(inds2[0] == i_ok);
+        CHECK(v2.str(0) == "kota");
+        CHECK(inds2[1] == i_null);
+        CHECK(v2.length(1) == 0);
+        CHECK(v2.buffer_size() == 5);
+
+        CHECK(!st.fetch());
+    }
+
     SECTION("short")
     {
         std::vector<short> v;
@@ -1962,6 +2062,282 @@ TEST_CASE_METHOD(common_tests, "Transactions", "[core][transaction]")
     }
 }
 
+TEST_CASE_METHOD(common_tests, "Nested transactions", "[core][transaction]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    if (!tc_.has_transactions_support(sql))
+    {
+        WARN("Transactions not supported by the database, skipping the test.");
+        return;
+    }
+
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+
+    int count;
+    {
+        transaction tr(sql);
+        CHECK(!tr.is_nested());
+        CHECK(sql.is_in_transaction());
+
+        sql << "insert into soci_test (id, name) values(1, 'John')";
+
+        {
+            transaction nested(sql);
+            CHECK(nested.is_nested());
+
+            sql << "insert into soci_test (id, name) values(2, 'Anna')";
+
+            nested.commit();
+        }
+
+        {
+            transaction nested(sql);
+
+            sql << "insert into soci_test (id, name) values(3, 'Mike')";
+
+            {
+                transaction nested2(sql);
+
+                sql << "insert into soci_test (id, name) values(4, 'Stan')";
+
+                sql << "select count(*) from soci_test", into(count);
+                CHECK(count == 4);
+
+                // Only the last insert is undone.
+                nested2.rollback();
+            }
+
+            sql << "select count(*) from soci_test", into(count);
+            CHECK(count == 3);
+        }
+
+        // The nested transaction is rolled back when it goes out of scope
+        // without being committed, but the outer one is not affected.
+        CHECK(sql.is_in_transaction());
+
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 2);
+
+        tr.commit();
+    }
+
+    CHECK(!sql.is_in_transaction());
+
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == 2);
+
+    {
+        transaction tr(sql);
+
+        {
+            transaction nested(sql);
+            sql << "delete from soci_test";
+            nested.commit();
+        }
+
+        tr.rollback();
+    }
+
+    // Committing the nested transaction doesn't commit the outer one.
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == 2);
+
+    // Ending the transaction using the session directly ends the nested ones
+    // too, which can't be used any more, but new ones can still be created.
+    {
+        transaction tr(sql);
+        transaction nested(sql);
+
+        sql << "delete from soci_test";
+
+        sql.commit();
+        CHECK(!sql.is_in_transaction());
+
+        CHECK_THROWS_AS(nested.commit(), soci_error&);
+        CHECK_THROWS_AS(nested.commit(), soci_error&);
+    }
+
+    {
+        transaction tr(sql);
+        transaction nested(sql);
+        sql << "insert into soci_test (id, name) values(5, 'Jane')";
+        nested.commit();
+        tr.commit();
+    }
+
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == 1);
+}
+
+TEST_CASE_METHOD(common_tests, "Group commit", "[core][transaction]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    if (!tc_.has_transactions_support(sql))
+    {
+        WARN("Transactions not supported by the database, skipping the test.");
+        return;
+    }
+
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+
+    sql.set_group_commit(3);
+
+    sql << "insert into soci_test (id) values(1)";
+    sql << "insert into soci_test (id) values(2)";
+    CHECK(sql.get_group_commit_pending() == 2);
+    CHECK(!sql.is_in_transaction());
+
+    int count;
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == 2);
+
+    // Reading the data doesn't count as a statement of the batch.
+    CHECK(sql.get_group_commit_pending() == 2);
+
+    // But the third statement modifying it commits the batch.
+    sql << "insert into soci_test (id) values(3)";
+    CHECK(sql.get_group_commit_pending() == 0);
+
+    SECTION("Failure")
+    {
+        sql << "insert into soci_test (id) values(4)";
+        CHECK(sql.get_group_commit_pending() == 1);
+
+        // Depending on the backend, this fails either when preparing the
+        // statement, in which case the batch is not affected, or when
+        // executing it, in which case the whole batch is rolled back.
+        CHECK_THROWS_AS(sql << "insert into soci_test_nonexistent (id) values(5)",
+                        soci_error&);
+
+        sql << "insert into soci_test (id) values(6)";
+        sql.flush_group_commit();
+
+        sql << "select count(*) from soci_test where id <= 3", into(count);
+        CHECK(count == 3);
+        sql << "select count(*) from soci_test where id = 6", into(count);
+        CHECK(count == 1);
+    }
+
+    SECTION("Failure undoing only the failed statement")
+    {
+        sql.set_group_commit(3, 0, true);
+
+        sql << "insert into soci_test (id) values(4)";
+        CHECK(sql.get_group_commit_pending() == 1);
+
+        CHECK_THROWS_AS(sql << "insert into soci_test_nonexistent (id) values(5)",
+                        soci_error&);
+
+        // Only the failed statement was undone, if it was executed at all.
+        CHECK(sql.get_group_commit_pending() == 1);
+
+        sql << "insert into soci_test (id) values(6)";
+        sql.flush_group_commit();
+
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 5);
+    }
+
+    SECTION("Maximal delay")
+    {
+        sql.flush_group_commit();
+        sql.set_group_commit(1000000, 1);
+
+        // The batch is committed by the first statement completing at least
+        // 1ms after the start of the batch, long before reaching the maximal
+        // number of statements.
+        int id = 10;
+        do
+        {
+            sql << "insert into soci_test (id) values(:id)", use(id);
+            ++id;
+        }
+        while (sql.get_group_commit_pending() != 0 && id < 100000);
+
+        CHECK(sql.get_group_commit_pending() == 0);
+
+        sql << "delete from soci_test";
+        sql.rollback();
+
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 3 + id - 10);
+    }
+
+    SECTION("Explicit flush")
+    {
+        sql.flush_group_commit();
+        CHECK(sql.get_group_commit_pending() == 0);
+
+        // Rolling back doesn't affect the already committed statements.
+        sql << "delete from soci_test";
+        sql.rollback();
+
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 3);
+    }
+
+    SECTION("Explicit transaction")
+    {
+        sql << "insert into soci_test (id) values(4)";
+        CHECK(sql.get_group_commit_pending() == 1);
+
+        {
+            // This commits the pending batch first.
+            transaction tr(sql);
+            CHECK(sql.get_group_commit_pending() == 0);
+
+            sql << "delete from soci_test";
+
+            // No group commit inside an explicit transaction.
+            CHECK(sql.get_group_commit_pending() == 0);
+        }
+
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 4);
+    }
+
+    sql.set_group_commit(0);
+}
+
+TEST_CASE_METHOD(common_tests, "Group commit with pooled session", "[core][transaction][pool]")
+{
+    connection_pool pool(1);
+    pool.at(0).open(backEndFactory_, connectString_);
+
+    soci::session sql(pool);
+
+    if (!tc_.has_transactions_support(sql))
+    {
+        WARN("Transactions not supported by the database, skipping the test.");
+        return;
+    }
+
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+
+    sql.set_group_commit(2);
+
+    // The statement created using the pool session itself, and not the
+    // pooled session it forwards to, must use group commit too.
+    int id = 1;
+    statement st(sql);
+    st.exchange(use(id));
+    st.alloc();
+    st.prepare("insert into soci_test (id) values(:id)");
+    st.define_and_bind();
+
+    st.execute(true);
+    CHECK(sql.get_group_commit_pending() == 1);
+    CHECK(pool.at(0).get_group_commit_pending() == 1);
+
+    id = 2;
+    st.execute(true);
+    CHECK(sql.get_group_commit_pending() == 0);
+
+    sql.set_group_commit(0);
+}
+
 std::tm  generate_tm()
 {
     std::tm t = std::tm();
@@ -2237,63 +2613,215 @@ TEST_CASE_METHOD(common_tests, "Dynamic row binding 3", "[core][dynamic]")
     CHECK(count == 3);
 }
 
-// This is like the previous test but with a type_conversion instead of a row
-TEST_CASE_METHOD(common_tests, "Dynamic binding with type conversions", "[core][dynamic][type_conversion]")
+// Rebinding a prepared statement to another row reuses the description of its
+// columns obtained when it was executed for the first time
+TEST_CASE_METHOD(common_tests, "Dynamic row binding after rebinding", "[core][dynamic]")
 {
     soci::session sql(backEndFactory_, connectString_);
 
     sql.uppercase_column_names(true);
 
-    SECTION("simple conversions")
-    {
-        auto_table_creator tableCreator(tc_.table_creator_1(sql));
+    auto_table_creator tableCreator(tc_.table_creator_3(sql));
 
-        SECTION("between single basic type and user type")
-        {
-            MyInt mi;
-            mi.set(123);
-            sql << "insert into soci_test(id) values(:id)", use(mi);
+    sql << "insert into soci_test values('david', '(404)123-4567')";
 
-            int i;
-            sql << "select id from soci_test", into(i);
-            CHECK(i == 123);
+    row r1;
+    statement st = (sql.prepare << "select name, phone from soci_test", into(r1));
+    st.execute(true);
+    REQUIRE(r1.size() == 2);
+    CHECK(r1.get<std::string>("NAME") == "david");
 
-            sql << "update soci_test set id = id + 1";
+    st.bind_clean_up();
 
-            sql << "select id from soci_test", into(mi);
-            CHECK(mi.get() == 124);
-        }
+    row r2;
+    st.exchange(into(r2));
+    st.define_and_bind();
+    st.execute(true);
+
+    REQUIRE(r2.size() == 2);
+    CHECK(r2.get_properties(0).get_name() == "NAME");
+    CHECK(r2.get_properties(1).get_data_type() == dt_string);
+    CHECK(r2.get<std::string>(0) == "david");
+    CHECK(r2.get<std::string>("PHONE") == "(404)123-4567");
+}
 
-        SECTION("with use const")
-        {
-            MyInt mi;
-            mi.set(123);
+// Iterating over rowset<row> for the same query again reuses the description
+// of its columns remembered by the session until the schema changes, if the
+// backend column types don't depend on the data
+TEST_CASE_METHOD(common_tests, "Dynamic row binding description cache", "[core][dynamic]")
+{
+    soci::session sql(backEndFactory_, connectString_);
 
-            MyInt const & cmi = mi;
-            sql << "insert into soci_test(id) values(:id)", use(cmi);
+    sql.uppercase_column_names(true);
+    auto_table_creator tableCreator(tc_.table_creator_3(sql));
 
-            int i;
-            sql << "select id from soci_test", into(i);
-            CHECK(i == 123);
-        }
+    sql << "insert into soci_test values('david', '(404)123-4567')";
+
+    std::string const query = "select name, phone from soci_test";
+    query_text const text = sql.intern_query(query);
+
+    CHECK(sql.get_column_descriptions(text) == NULL);
+
+    {
+        rowset<row> rs = (sql.prepare << query);
+        rowset<row>::const_iterator const it = rs.begin();
+        REQUIRE(it != rs.end());
+        CHECK(it->get_properties(0).get_name() == "NAME");
     }
 
-    SECTION("ORM conversions")
+    std::vector<column_properties> const *
+        columns = sql.get_column_descriptions(text);
+    if (columns == NULL)
     {
-        auto_table_creator tableCreator(tc_.table_creator_3(sql));
+        WARN("Column descriptions are not reused by this backend.");
+        return;
+    }
 
-        SECTION("conversions based on values")
-        {
-            PhonebookEntry p1;
-            sql << "select * from soci_test", into(p1);
-            CHECK(p1.name ==  "");
-            CHECK(p1.phone == "");
+    REQUIRE(columns->size() == 2);
+    CHECK((*columns)[0].get_name() == "NAME");
+    CHECK((*columns)[1].get_name() == "PHONE");
 
-            p1.name = "david";
+    // replace the remembered description to check that the next statement
+    // uses it instead of describing the query again
+    std::vector<column_properties> modified(*columns);
+    modified[0].set_name("CACHED");
+    sql.set_column_descriptions(text, modified);
 
-            // Note: uppercase column names are used here (and later on)
-            // for consistency with how they can be read from database
-            // (which means forced to uppercase on Oracle) and how they are
+    {
+        rowset<row> rs = (sql.prepare << query);
+        rowset<row>::const_iterator const it = rs.begin();
+        REQUIRE(it != rs.end());
+        CHECK(it->get_properties(0).get_name() == "CACHED");
+        CHECK(it->get<std::string>("CACHED") == "david");
+    }
+
+    // changing the schema invalidates the remembered descriptions
+    sql << "create table soci_test_2 (id integer)";
+    sql << "drop table soci_test_2";
+
+    CHECK(sql.get_column_descriptions(text) == NULL);
+
+    // and so does any error
+    {
+        rowset<row> rs = (sql.prepare << query);
+    }
+    REQUIRE(sql.get_column_descriptions(text) != NULL);
+
+    CHECK_THROWS_AS((sql << "select * from soci_test_nosuchtable"), soci_error&);
+    CHECK(sql.get_column_descriptions(text) == NULL);
+}
+
+// Dynamic binding using pre-resolved column accessors
+TEST_CASE_METHOD(common_tests, "Dynamic row binding with column accessors", "[core][dynamic]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    sql.uppercase_column_names(true);
+
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+
+    sql << "insert into soci_test(id, str) values(1, 'one')";
+    sql << "insert into soci_test(id, str) values(2, NULL)";
+    sql << "insert into soci_test(id, str) values(3, 'three')";
+
+    row r;
+    statement st = (sql.prepare <<
+        "select id, str from soci_test order by id", into(r));
+    st.execute();
+
+    column_accessor<int> const id = r.get_accessor<int>("ID");
+    column_accessor<std::string> const str = r.get_accessor<std::string>(1);
+    CHECK(id.get_position() == 0);
+    CHECK(str.get_position() == 1);
+
+    // the type is checked when resolving the accessor
+    CHECK_THROWS_AS(r.get_accessor<std::string>("ID"), std::bad_cast&);
+    CHECK_THROWS_AS(r.get_accessor<int>("NO_SUCH_COLUMN"), soci_error&);
+
+    int count = 0;
+    while (st.fetch())
+    {
+        ++count;
+        CHECK(r.get(id) == count);
+        CHECK(r.get(id) == r.get<int>("ID"));
+        if (count == 2)
+        {
+            CHECK(r.get(str, std::string("null")) == "null");
+        }
+        else
+        {
+            CHECK(r.get(str) == r.get<std::string>(1));
+        }
+    }
+    CHECK(count == 3);
+
+    // the accessors can't be used with another row nor after the row is
+    // described again
+    row r2;
+    sql << "select id from soci_test where id = 1", into(r2);
+    CHECK_THROWS_AS(r2.get(id), soci_error&);
+
+    sql << "select id, str from soci_test where id = 1", into(r);
+    CHECK_THROWS_AS(r.get(id), soci_error&);
+}
+
+// This is like the previous test but with a type_conversion instead of a row
+TEST_CASE_METHOD(common_tests, "Dynamic binding with type conversions", "[core][dynamic][type_conversion]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    sql.uppercase_column_names(true);
+
+    SECTION("simple conversions")
+    {
+        auto_table_creator tableCreator(tc_.table_creator_1(sql));
+
+        SECTION("between single basic type and user type")
+        {
+            MyInt mi;
+            mi.set(123);
+            sql << "insert into soci_test(id) values(:id)", use(mi);
+
+            int i;
+            sql << "select id from soci_test", into(i);
+            CHECK(i == 123);
+
+            sql << "update soci_test set id = id + 1";
+
+            sql << "select id from soci_test", into(mi);
+            CHECK(mi.get() == 124);
+        }
+
+        SECTION("with use const")
+        {
+            MyInt mi;
+            mi.set(123);
+
+            MyInt const & cmi = mi;
+            sql << "insert into soci_test(id) values(:id)", use(cmi);
+
+            int i;
+            sql << "select id from soci_test", into(i);
+            CHECK(i == 123);
+        }
+    }
+
+    SECTION("ORM conversions")
+    {
+        auto_table_creator tableCreator(tc_.table_creator_3(sql));
+
+        SECTION("conversions based on values")
+        {
+            PhonebookEntry p1;
+            sql << "select * from soci_test", into(p1);
+            CHECK(p1.name ==  "");
+            CHECK(p1.phone == "");
+
+            p1.name = "david";
+
+            // Note: uppercase column names are used here (and later on)
+            // for consistency with how they can be read from database
+            // (which means forced to uppercase on Oracle) and how they are
             // set/get in the type conversion routines for PhonebookEntry.
             // In short, IF the database is Oracle,
             // then all column names for binding should be uppercase.
@@ -2417,6 +2945,198 @@ TEST_CASE_METHOD(common_tests, "Prepared insert with ORM", "[core][orm]")
     CHECK(count == 2);
 }
 
+TEST_CASE_METHOD(common_tests, "Prepared insert with positional ORM", "[core][orm]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    sql.uppercase_column_names(true);
+    auto_table_creator tableCreator(tc_.table_creator_3(sql));
+
+    PhonebookEntry4 temp;
+    statement insertStatement = (sql.prepare << "insert into soci_test values (:n, :p)", use(temp));
+
+    // the values must be updated in place for every execution
+    for (int i = 0; i != 3; ++i)
+    {
+        std::ostringstream oss;
+        oss << i;
+        temp.name = "name" + oss.str();
+        temp.phone = "phone" + oss.str();
+        insertStatement.execute(true);
+    }
+
+    int count = 0;
+    sql << "select count(*) from soci_test where name in ('name0', 'name1', 'name2')", into(count);
+    CHECK(count == 3);
+
+    std::string phone;
+    sql << "select phone from soci_test where name = 'name2'", into(phone);
+    CHECK(phone == "phone2");
+}
+
+TEST_CASE_METHOD(common_tests, "Reusing bound values", "[core][orm]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    sql.uppercase_column_names(true);
+    auto_table_creator tableCreator(tc_.table_creator_3(sql));
+
+    // setting a value using a different type replaces it if not bound yet
+    values v;
+    v.set("NAME", 17);
+    v.set("NAME", std::string("name1"));
+    CHECK(v.get<std::string>("NAME") == "name1");
+    v.set("PHONE", std::string("phone1"));
+
+    statement st = (sql.prepare <<
+        "insert into soci_test values (:NAME, :PHONE)", use(v));
+    st.execute(true);
+
+    v.set("NAME", std::string("name2"));
+    v.set("PHONE", std::string("phone2"));
+    st.execute(true);
+
+    // but the bound elements can't be changed or added to any more
+    CHECK_THROWS_AS(v.set("NAME", 17), soci_error&);
+    CHECK_THROWS_AS(v.set("EXTRA", std::string("extra")), soci_error&);
+
+    int count = 0;
+    sql << "select count(*) from soci_test where name in ('name1', 'name2')", into(count);
+    CHECK(count == 2);
+}
+
+TEST_CASE_METHOD(common_tests, "Bulk insert and select with ORM", "[core][orm][bulk]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    sql.uppercase_column_names(true);
+    auto_table_creator tableCreator(tc_.table_creator_3(sql));
+
+    std::vector<PhonebookEntry> in(10);
+    for (std::size_t i = 0; i != in.size(); ++i)
+    {
+        std::ostringstream oss;
+        oss << i;
+        in[i].name = "name" + oss.str();
+
+        // leave some phones empty to store them as NULL
+        if (i % 3)
+        {
+            in[i].phone = "phone" + oss.str();
+        }
+    }
+
+    sql << "insert into soci_test values (:NAME, :PHONE)", use(in);
+
+    int count = 0;
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == 10);
+
+    // the same with positional values and a prepared statement
+    {
+        std::vector<PhonebookEntry4> in4(3);
+        in4[0].name = "pos0";
+        in4[1].name = "pos1";
+        in4[2].name = "pos2";
+        in4[0].phone = in4[1].phone = in4[2].phone = "pos";
+
+        statement st = (sql.prepare << "insert into soci_test values (:n, :p)", use(in4));
+        st.execute(true);
+
+        in4.resize(2);
+        in4[0].name = "pos3";
+        in4[1].name = "pos4";
+        st.execute(true);
+
+        sql << "select count(*) from soci_test where phone = 'pos'", into(count);
+        CHECK(count == 5);
+
+        sql << "delete from soci_test where phone = 'pos'";
+    }
+
+    std::vector<PhonebookEntry> out(4);
+    statement st = (sql.prepare <<
+        "select * from soci_test order by name", into(out));
+    st.execute();
+
+    std::vector<PhonebookEntry> all;
+    while (st.fetch())
+    {
+        CHECK(out.size() <= 4);
+        all.insert(all.end(), out.begin(), out.end());
+        out.resize(4);
+    }
+
+    REQUIRE(all.size() == 10);
+
+    // "name0" < "name1" < ... < "name9"
+    for (std::size_t i = 0; i != all.size(); ++i)
+    {
+        CHECK(all[i].name == in[i].name);
+        if (i % 3)
+        {
+            CHECK(all[i].phone == in[i].phone);
+        }
+        else
+        {
+            CHECK(all[i].phone == "<NULL>");
+        }
+    }
+}
+
+TEST_CASE_METHOD(common_tests, "Copying values", "[core][orm][bulk]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    sql.uppercase_column_names(true);
+    auto_table_creator tableCreator(tc_.table_creator_3(sql));
+
+    sql << "insert into soci_test values ('name1', 'phone1')";
+    sql << "insert into soci_test values ('name2', NULL)";
+
+    // values fetched in bulk
+    std::vector<values> copies;
+    {
+        std::vector<values> rows(10);
+        statement st = (sql.prepare <<
+            "select * from soci_test order by name", into(rows));
+        st.execute(true);
+        REQUIRE(rows.size() == 2);
+
+        copies = rows;
+    }
+
+    REQUIRE(copies.size() == 2);
+    CHECK(copies[0].get<std::string>("NAME") == "name1");
+    CHECK(copies[0].get<std::string>("PHONE") == "phone1");
+    CHECK(copies[1].get<std::string>("NAME") == "name2");
+    CHECK(copies[1].get_indicator("PHONE") == i_null);
+
+    // values fetched into a row
+    values copy;
+    {
+        values v;
+        statement st = (sql.prepare <<
+            "select * from soci_test where name = 'name1'", into(v));
+        st.execute(true);
+
+        copy = v;
+    }
+
+    CHECK(copy.get_number_of_columns() == 2);
+    CHECK(copy.get<std::string>("NAME") == "name1");
+    CHECK(copy.get<std::string>(1) == "phone1");
+
+    // values set explicitly
+    values set;
+    set.set("x", 17);
+    set.set("y", std::string("y"), i_null);
+
+    values const setCopy(set);
+    CHECK(setCopy.get<int>("x") == 17);
+    CHECK(setCopy.get_indicator("y") == i_null);
+}
+
 TEST_CASE_METHOD(common_tests, "Partial match with ORM", "[core][orm]")
 {
     soci::session sql(backEndFactory_, connectString_);
@@ -2852,6 +3572,367 @@ TEST_CASE_METHOD(common_tests, "Rowset expected exception", "[core][exception][r
         );
 }
 
+TEST_CASE_METHOD(common_tests, "Query text interning", "[core][query]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    std::string const query = "select 1" + sql.get_dummy_from_clause();
+    std::string const other = "select 2" + sql.get_dummy_from_clause();
+
+    int n = 0;
+    statement st1 = (sql.prepare << query, into(n));
+    statement st2 = (sql.prepare << query, into(n));
+    statement st3 = (sql.prepare << other, into(n));
+
+    query_text const & text1 = st1.get_query_text();
+    query_text const & text2 = st2.get_query_text();
+    query_text const & text3 = st3.get_query_text();
+
+    CHECK(text1.str() == query);
+    CHECK(text1.hash() == query_text::compute_hash(query));
+
+    // The same query must be shared.
+    CHECK(text1.is_same(text2));
+    CHECK(text1 == text2);
+
+    CHECK(!text1.is_same(text3));
+    CHECK(text1 != text3);
+    CHECK(text1.hash() != text3.hash());
+
+    // Query texts created independently still compare equal.
+    query_text const copy(query);
+    CHECK(!copy.is_same(text1));
+    CHECK(copy == text1);
+
+    query_text empty;
+    CHECK(empty.empty());
+    CHECK(empty.str().empty());
+    CHECK(empty == query_text(std::string()));
+
+    empty = copy;
+    CHECK(empty.is_same(copy));
+
+    st2.execute(true);
+    CHECK(n == 1);
+}
+
+#if defined(SOCI_HAVE_CXX_C11) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+
+TEST_CASE_METHOD(common_tests, "Moving sessions, statements and rowsets", "[core][move]")
+{
+    SECTION("Session")
+    {
+        soci::session sql(backEndFactory_, connectString_);
+        sql.uppercase_column_names(true);
+
+        std::vector<soci::session> sessions;
+        sessions.push_back(std::move(sql));
+
+        // The moved-from session is closed but can be reopened.
+        CHECK(sql.get_backend() == NULL);
+        CHECK(!sql.get_uppercase_column_names());
+
+        soci::session & moved = sessions.back();
+        CHECK(moved.get_uppercase_column_names());
+
+        int one = 0;
+        moved << "select 1" + moved.get_dummy_from_clause(), into(one);
+        CHECK(one == 1);
+
+        sql.open(backEndFactory_, connectString_);
+        sql << "select 1" + sql.get_dummy_from_clause(), into(one);
+
+        // Moving the session used by a statement is not allowed.
+        statement st = (moved.prepare << "select 1" + moved.get_dummy_from_clause());
+        CHECK_THROWS_AS(soci::session(std::move(moved)), soci_error&);
+        CHECK_THROWS_AS(sql = std::move(moved), soci_error&);
+        CHECK(moved.get_backend() != NULL);
+
+        // Moving another session closes the one being assigned to.
+        soci::session other(backEndFactory_, connectString_);
+        other = std::move(sql);
+        CHECK(sql.get_backend() == NULL);
+        CHECK(other.get_backend() != NULL);
+    }
+
+    SECTION("Pooled session")
+    {
+        connection_pool pool(1);
+        pool.at(0).open(backEndFactory_, connectString_);
+
+        {
+            soci::session sql(pool);
+            soci::session moved(std::move(sql));
+
+            int one = 0;
+            moved << "select 1" + moved.get_dummy_from_clause(), into(one);
+            CHECK(one == 1);
+
+            std::size_t pos;
+            CHECK(!pool.try_lease(pos, 0));
+        }
+
+        // The session must have been given back to the pool only once.
+        std::size_t pos;
+        REQUIRE(pool.try_lease(pos, 0));
+        pool.give_back(pos);
+    }
+
+    soci::session sql(backEndFactory_, connectString_);
+
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+    for (int i = 1; i <= 3; ++i)
+    {
+        sql << "insert into soci_test(id) values(:id)", use(i);
+    }
+
+    SECTION("Statement")
+    {
+        int id = 0;
+        std::vector<statement> statements;
+        {
+            statement st = (sql.prepare << "select id from soci_test order by id",
+                                into(id));
+            statements.push_back(std::move(st));
+        }
+
+        statement & st = statements.back();
+        st.execute();
+        CHECK(st.fetch());
+        CHECK(id == 1);
+
+        statement moved(std::move(st));
+        CHECK(moved.fetch());
+        CHECK(id == 2);
+
+        // Moved-from statement can be assigned to.
+        st = std::move(moved);
+        CHECK(st.fetch());
+        CHECK(id == 3);
+        CHECK(!st.fetch());
+    }
+
+    SECTION("Rowset")
+    {
+        rowset<int> rs = (sql.prepare << "select id from soci_test");
+
+        rowset<int> moved(std::move(rs));
+        CHECK(std::distance(moved.begin(), moved.end()) == 3);
+
+        rs = std::move(moved);
+        rowset<int> copy(rs);
+        CHECK(copy.begin() == copy.end());
+    }
+}
+
+#endif // C++11
+
+TEST_CASE_METHOD(common_tests, "Asynchronous statement execution", "[core][async]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+    for (int i = 1; i <= 3; ++i)
+    {
+        sql << "insert into soci_test(id) values(:id)", use(i);
+    }
+
+    int id = 2;
+    int out = 0;
+    statement st = (sql.prepare << "select id from soci_test where id = :id",
+        use(id), into(out));
+
+    // The socket is only returned by the backends supporting it, but the
+    // statement can be executed in the same way in any case.
+    int const socket = st.start_execute();
+    if (socket == -1)
+    {
+        CHECK(!st.is_result_pending());
+    }
+    else
+    {
+        CHECK_THROWS_AS(st.start_execute(), soci_error&);
+    }
+
+    while (st.is_result_pending())
+    {
+        // A real application would wait for the socket to become readable.
+    }
+
+    CHECK(st.execute(true));
+    CHECK(out == 2);
+
+    // The statement can be executed normally after it.
+    id = 3;
+    CHECK(st.execute(true));
+    CHECK(out == 3);
+
+    // And asynchronously again.
+    id = 1;
+    st.start_execute();
+    while (st.is_result_pending())
+    {
+    }
+    CHECK(st.execute(true));
+    CHECK(out == 1);
+}
+
+#ifdef SOCI_HAVE_COROUTINES
+
+TEST_CASE_METHOD(common_tests, "Streaming rows using coroutines", "[core][rowset][generator]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+    for (int i = 1; i <= 10; ++i)
+    {
+        sql << "insert into soci_test(id) values(:id)", use(i);
+    }
+
+    SECTION("Rows")
+    {
+        int sum = 0;
+        for (row const & r : stream_rows(sql.prepare << "select id from soci_test"))
+        {
+            sum += r.get<int>(0);
+        }
+
+        CHECK(sum == 55);
+    }
+
+    SECTION("Values")
+    {
+        auto ids = stream_rows<int>(sql.prepare << "select id from soci_test");
+
+        int count = 0;
+        for (auto it = ids.begin(); it != ids.end(); ++it)
+        {
+            if (++count == 3)
+            {
+                // Interrupting the iteration must be possible too.
+                break;
+            }
+        }
+
+        CHECK(count == 3);
+    }
+
+    SECTION("Batches")
+    {
+        std::vector<std::size_t> sizes;
+        int sum = 0;
+        for (std::vector<int> & batch : stream_batches<int>(
+                sql.prepare << "select id from soci_test", 4))
+        {
+            sizes.push_back(batch.size());
+            for (std::size_t n = 0; n != batch.size(); ++n)
+            {
+                sum += batch[n];
+            }
+
+            // The vector can be reused by the caller.
+            std::vector<int>().swap(batch);
+        }
+
+        CHECK(sum == 55);
+        REQUIRE(sizes.size() == 3);
+        CHECK(sizes[0] == 4);
+        CHECK(sizes[1] == 4);
+        CHECK(sizes[2] == 2);
+    }
+
+    SECTION("Error")
+    {
+        auto rows = stream_rows(sql.prepare << "select * from soci_no_such_table");
+        CHECK_THROWS_AS(rows.begin(), soci_error&);
+    }
+}
+
+TEST_CASE_METHOD(common_tests, "Streaming rows asynchronously", "[core][rowset][generator][async]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+    for (int i = 1; i <= 10; ++i)
+    {
+        sql << "insert into soci_test(id) values(:id)", use(i);
+    }
+
+    SECTION("Several streams")
+    {
+        // Each stream needs its own connection with the backends which can
+        // only have a single query in progress.
+        soci::session sqlOther(backEndFactory_, connectString_);
+
+        int const base = 17;
+        auto ids = async_stream_rows<int>(sql.prepare << "select id from soci_test");
+        auto others = async_stream_rows<int>((sqlOther.prepare
+            << "select 25 + :base" + sqlOther.get_dummy_from_clause(), use(base)));
+
+        // Advance both streams from the same thread without blocking.
+        int sum = 0;
+        int other = 0;
+        while (!ids.done() || !others.done())
+        {
+            if (!ids.done() && ids.poll() && !ids.done())
+            {
+                sum += ids.value();
+            }
+
+            if (!others.done() && others.poll() && !others.done())
+            {
+                other = others.value();
+            }
+        }
+
+        CHECK(sum == 55);
+        CHECK(other == 42);
+    }
+
+    SECTION("Batches")
+    {
+        auto batches = async_stream_batches<int>(
+            sql.prepare << "select id from soci_test", 4);
+
+        std::vector<std::size_t> sizes;
+        while (!batches.done())
+        {
+            if (batches.poll() && !batches.done())
+            {
+                sizes.push_back(batches.value().size());
+            }
+            else if (!batches.done())
+            {
+                CHECK(batches.socket() != -1);
+            }
+        }
+
+        REQUIRE(sizes.size() == 3);
+        CHECK(sizes[0] == 4);
+        CHECK(sizes[2] == 2);
+    }
+
+    SECTION("Interrupted")
+    {
+        auto ids = async_stream_rows<int>(sql.prepare << "select id from soci_test");
+        while (!ids.poll())
+        {
+        }
+
+        CHECK(!ids.done());
+
+        // Destroying the stream before its end must be possible.
+    }
+
+    SECTION("Error")
+    {
+        auto rows = async_stream_rows(sql.prepare << "select * from soci_no_such_table");
+        CHECK_THROWS_AS(rows.poll(), soci_error&);
+    }
+}
+
+#endif // SOCI_HAVE_COROUTINES
+
 // functor for next test
 struct THelper
 {
@@ -3332,6 +4413,67 @@ TEST_CASE_METHOD(common_tests, "Connection and reconnection", "[core][connect]")
 
 }
 
+TEST_CASE_METHOD(common_tests, "Statements after reconnection", "[core][connect]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+
+    int in = 1;
+    int out = 0;
+    statement st = (sql.prepare << "select 17 + :i" + sql.get_dummy_from_clause(),
+                    into(out), use(in));
+    st.execute(true);
+    CHECK(out == 18);
+
+    // The statement is prepared again using the new connection.
+    sql.reconnect();
+
+    in = 2;
+    st.execute(true);
+    CHECK(out == 19);
+
+    // And also after explicitly closing and reopening the session.
+    sql.close();
+    sql.reconnect();
+
+    in = 3;
+    st.execute(true);
+    CHECK(out == 20);
+
+    SECTION("Pooled session")
+    {
+        connection_pool pool(1);
+        pool.at(0).open(backEndFactory_, connectString_);
+
+        soci::session sqlPool(pool);
+
+        // This statement is registered with the pool session and not with
+        // the pooled one to which reconnect() is forwarded.
+        statement stPool(sqlPool);
+        stPool.exchange(into(out));
+        stPool.exchange(use(in));
+        stPool.alloc();
+        stPool.prepare("select 17 + :i" + sqlPool.get_dummy_from_clause());
+        stPool.define_and_bind();
+
+        in = 4;
+        stPool.execute(true);
+        CHECK(out == 21);
+
+        sqlPool.reconnect();
+
+        in = 5;
+        stPool.execute(true);
+        CHECK(out == 22);
+
+        sqlPool.close();
+        sqlPool.reconnect();
+
+        in = 6;
+        stPool.execute(true);
+        CHECK(out == 23);
+    }
+}
+
 #ifdef SOCI_HAVE_BOOST
 
 TEST_CASE_METHOD(common_tests, "Boost tuple", "[core][boost][tuple]")
@@ -3959,6 +5101,182 @@ TEST_CASE_METHOD(common_tests, "Backend with connection pool", "[core][pool]")
     sql.begin(); // no crash expected
 }
 
+TEST_CASE_METHOD(common_tests, "Routing pool", "[core][pool]")
+{
+    connection_pool * const primary = new connection_pool(2);
+    primary->at(0).open(backEndFactory_, connectString_);
+    primary->at(1).open(backEndFactory_, connectString_);
+
+    routing_pool::replica_selection selection = routing_pool::round_robin;
+    SECTION("Round robin")
+    {
+    }
+    SECTION("Least loaded")
+    {
+        selection = routing_pool::least_loaded;
+    }
+
+    routing_pool router(primary, selection);
+
+    // Without replicas, everything goes to the primary.
+    CHECK(&router.lease_for_read() == primary);
+    CHECK(&router.lease_for_write() == primary);
+
+    connection_pool * const replica1 = new connection_pool(2);
+    replica1->at(0).open(backEndFactory_, connectString_);
+    replica1->at(1).open(backEndFactory_, connectString_);
+    router.add_replica(replica1);
+
+    // This replica is never connected and so is not healthy.
+    connection_pool * const replica2 = new connection_pool(1);
+    router.add_replica(replica2);
+
+    CHECK(router.get_replicas_count() == 2);
+    CHECK(router.is_replica_healthy(1));
+
+    router.check_replicas();
+    CHECK(router.is_replica_healthy(0));
+    CHECK(!router.is_replica_healthy(1));
+
+    CHECK(&router.lease_for_read() == replica1);
+    CHECK(&router.lease_for_read() == replica1);
+
+    router.set_replica_healthy(1, true);
+
+    {
+        session sql(*replica1);
+
+        if (selection == routing_pool::least_loaded)
+        {
+            // Both replicas have one free session now, but after leasing the
+            // other session from the first one, the second is used.
+            session sql2(*replica1);
+            CHECK(&router.lease_for_read() == replica2);
+        }
+        else
+        {
+            // Both replicas are used in turn.
+            connection_pool * const first = &router.lease_for_read();
+            connection_pool * const second = &router.lease_for_read();
+            CHECK(first != second);
+        }
+    }
+
+    router.set_replica_healthy(0, false);
+    router.set_replica_healthy(1, false);
+    CHECK(&router.lease_for_read() == primary);
+
+    router.set_replica_healthy(0, true);
+
+    routed_session rs(router);
+
+    int one = 0;
+    rs.for_read() << "select 1" + rs.for_read().get_dummy_from_clause(),
+        into(one);
+    CHECK(one == 1);
+
+    if (tc_.has_transactions_support(rs.for_write()))
+    {
+        CHECK(&rs.for_read() != &rs.for_write());
+
+        transaction tr(rs.for_write());
+
+        // Reads are done using the primary during the transaction.
+        CHECK(&rs.for_read() == &rs.for_write());
+
+        tr.commit();
+
+        CHECK(&rs.for_read() != &rs.for_write());
+    }
+}
+
+TEST_CASE_METHOD(common_tests, "Parallel scan", "[core][pool][scan]")
+{
+    // Use a single session pool, so that all threads see the same data even
+    // with in-memory databases.
+    connection_pool pool(1);
+    pool.at(0).open(backEndFactory_, connectString_);
+
+    auto_table_creator tableCreator(tc_.table_creator_1(pool.at(0)));
+
+    int const count = 100;
+    for (int i = 0; i != count; ++i)
+    {
+        int const val = i % 3;
+        pool.at(0) << "insert into soci_test(id, val) values(:id, :val)",
+            use(i), use(val);
+    }
+
+    parallel_scan scan(pool,
+        "select id from soci_test where val = :partition", 3);
+    scan.set_batch_size(7);
+    scan.set_threads(2);
+
+    SECTION("Queue")
+    {
+        scan_queue queue(2);
+        scan.start(queue);
+
+        std::vector<int> seen(count, 0);
+        std::size_t partition;
+        std::vector<values> rows;
+        while (queue.pop(partition, rows))
+        {
+            CHECK(partition < 3);
+            CHECK(rows.size() <= 7);
+
+            for (std::size_t n = 0; n != rows.size(); ++n)
+            {
+                int const id = rows[n].get<int>(0);
+                REQUIRE(id >= 0);
+                REQUIRE(id < count);
+                CHECK(id % 3 == static_cast<int>(partition));
+                ++seen[id];
+            }
+        }
+
+        scan.wait();
+
+        CHECK(std::count(seen.begin(), seen.end(), 1) == count);
+    }
+
+    SECTION("Stop with full queue")
+    {
+        scan_queue queue(1);
+        scan.start(queue);
+
+        std::size_t partition;
+        std::vector<values> rows;
+        REQUIRE(queue.pop(partition, rows));
+
+        // Wait until the worker thread fills the queue again and blocks
+        // trying to add the next batch to it.
+        while (queue.size() != 1)
+            ;
+
+        scan.stop();
+
+        // The remaining batches are discarded and the worker threads don't
+        // wait for them to be consumed, so this doesn't block.
+        CHECK(!queue.pop(partition, rows));
+        scan.wait();
+    }
+
+    SECTION("Error")
+    {
+        parallel_scan bad(pool, "select * from soci_no_such_table", 3);
+
+        scan_queue queue(1);
+        bad.start(queue);
+
+        std::size_t partition;
+        std::vector<values> rows;
+        CHECK(!queue.pop(partition, rows));
+
+        CHECK_THROWS_AS(bad.wait(), soci_error&);
+    }
+}
+
 // issue 67 - Allocated statement backend memory leaks on exception
 // If the test runs under memory debugger and it passes, then
 // soci::details::statement_impl::backEnd_ must not leak
@@ -4460,6 +5778,122 @@ TEST_CASE_METHOD(common_tests, "Logger", "[core][log]")
     sql.set_logger(logger_orig);
 }
 
+TEST_CASE_METHOD(common_tests, "Result cache", "[core][cache]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+
+    sql << "insert into soci_test(id, str) values(1, 'one')";
+    sql << "insert into soci_test(id, str) values(2, NULL)";
+
+    result_cache cache(2);
+    sql.set_result_cache(&cache);
+
+    std::string const query = "select str from soci_test where id = :id";
+
+    int id = 1;
+    std::string str;
+    indicator ind;
+    sql << query, cached(), into(str, ind), use(id);
+    CHECK(ind == i_ok);
+    CHECK(str == "one");
+    CHECK(cache.size() == 1);
+    CHECK(cache.get_misses() == 1);
+
+    // Modify the table behind the cache back: the cached value is returned.
+    sql << "update soci_test set str = 'uno' where id = 1";
+
+    str.clear();
+    sql << query, cached(), into(str, ind), use(id);
+    CHECK(str == "one");
+    CHECK(cache.get_hits() == 1);
+
+    SECTION("Different parameters")
+    {
+        id = 2;
+        sql << query, cached(), into(str, ind), use(id);
+        CHECK(ind == i_null);
+
+        id = 3;
+        sql << query, cached(), into(str, ind), use(id);
+        CHECK(sql.got_data() == false);
+
+        // The result of the same query with id = 1 was evicted.
+        CHECK(cache.size() == 2);
+
+        sql << query, cached(), into(str, ind), use(id);
+        CHECK(sql.got_data() == false);
+        CHECK(cache.get_hits() == 2);
+
+        id = 1;
+        sql << query, cached(), into(str, ind), use(id);
+        CHECK(str == "uno");
+    }
+
+    SECTION("Invalidation")
+    {
+        cache.invalidate("select count(*) from soci_test");
+        CHECK(cache.size() == 1);
+
+        cache.invalidate(query);
+        CHECK(cache.size() == 0);
+
+        sql << query, cached(), into(str, ind), use(id);
+        CHECK(str == "uno");
+    }
+
+    SECTION("Different into type")
+    {
+        std::string const queryId = "select id from soci_test where id = 1";
+
+        int i = 0;
+        sql << queryId, cached(), into(i);
+        CHECK(i == 1);
+
+        long long ll = 0;
+        sql << queryId, cached(), into(ll);
+        CHECK(ll == 1);
+
+        // the cached result of a different type is not a hit
+        CHECK(cache.get_hits() == 1);
+        CHECK(cache.get_misses() == 3);
+    }
+
+    SECTION("Queries not marked as cached")
+    {
+        sql << query, into(str, ind), use(id);
+        CHECK(str == "uno");
+        CHECK(cache.get_hits() == 1);
+        CHECK(cache.get_misses() == 1);
+
+        statement st = (sql.prepare << query, into(str, ind), use(id));
+        st.execute(true);
+        CHECK(str == "uno");
+        CHECK(cache.get_hits() == 1);
+    }
+
+    SECTION("Time to live")
+    {
+        // the time to live of the cache can be overridden for a query
+        result_cache cacheWithTTL(2, 60);
+        sql.set_result_cache(&cacheWithTTL);
+
+        sql << query, cached(0), into(str, ind), use(id);
+        sql << query, cached(0), into(str, ind), use(id);
+        CHECK(cacheWithTTL.get_hits() == 1);
+    }
+
+    SECTION("No cache")
+    {
+        sql.set_result_cache(NULL);
+
+        CHECK_THROWS_AS((sql << query, cached(), into(str, ind), use(id)),
+                        soci_error&);
+    }
+
+    sql.set_result_cache(NULL);
+}
+
 } // namespace test_cases
 
 } // namespace tests
@@ -371,6 +371,57 @@ TEST_CASE("MySQL datetime", "[mysql][datetime]")
     CHECK(t.tm_sec == 52);
 }
 
+// timestamp values are always exchanged in UTC, whatever the initial session
+// time zone
+TEST_CASE("MySQL timestamp", "[mysql][timestamp]")
+{
+    soci::session sql(backEnd, connectString);
+
+    sql << "set time_zone = '+05:00'";
+
+    try { sql << "drop table test_ts"; }
+    catch (soci_error const &) {} // ignore if error
+
+    sql << "create table test_ts (id integer, ts timestamp(6) null)";
+
+    // 2009-06-17 22:51:03.123456 UTC
+    timestamp const t1(1245279063123456LL);
+
+    std::vector<int> ids;
+    std::vector<timestamp> tss;
+    for (int i = 0; i != 3; ++i)
+    {
+        ids.push_back(i);
+        tss.push_back(timestamp(t1.microseconds + i * 1000000LL));
+    }
+    sql << "insert into test_ts(id, ts) values(:id, :ts)", use(ids), use(tss);
+
+    long long secs = 0;
+    sql << "select floor(unix_timestamp(ts)) from test_ts where id = 0",
+        into(secs);
+    CHECK(secs == 1245279063LL);
+
+    timestamp t2;
+    sql << "select ts from test_ts where id = 0", into(t2);
+    CHECK(t2.microseconds == t1.microseconds);
+
+    std::vector<timestamp> v(3);
+    sql << "select ts from test_ts order by id", into(v);
+    REQUIRE(v.size() == 3);
+    CHECK(v[0].microseconds == t1.microseconds);
+    CHECK(v[2].microseconds == t1.microseconds + 2000000LL);
+
+    // the session time zone is switched to UTC once and stays so
+    std::string tz, utc;
+    sql << "select @@session.time_zone", into(tz);
+    CHECK(tz == "+00:00");
+
+    sql << "select cast(ts as char) from test_ts where id = 0", into(utc);
+    CHECK(utc == "2009-06-17 22:51:03.123456");
+
+    sql << "drop table test_ts";
+}
+
 // TEXT and BLOB types support test.
 TEST_CASE("MySQL text and blob", "[mysql][text][blob]")
 {
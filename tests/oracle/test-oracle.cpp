@@ -1421,6 +1421,158 @@ TEST_CASE("Bulk iterators", "[oracle][bulkiters]")
     sql << "drop table t";
 }
 
+TEST_CASE("Oracle statement cache and session pool", "[oracle][cache]")
+{
+    SECTION("Statement cache")
+    {
+        soci::session sql(backEnd, connectString + " stmt_cache_size=10");
+
+        sql << "create table t (i integer)";
+
+        // the same query is found in the cache when it is prepared again
+        for (int i = 0; i != 5; ++i)
+        {
+            sql << "insert into t (i) values (:i)", soci::use(i);
+        }
+
+        for (int i = 0; i != 5; ++i)
+        {
+            int n = 0;
+            sql << "select count(*) from t where i <= :i",
+                soci::use(i), soci::into(n);
+            CHECK(n == i + 1);
+        }
+
+        sql << "drop table t";
+    }
+
+    SECTION("Session pool")
+    {
+        std::string const pooledConnectString =
+            connectString + " session_pool=2 stmt_cache_size=5";
+
+        for (int i = 0; i != 3; ++i)
+        {
+            soci::session sql1(backEnd, pooledConnectString);
+            soci::session sql2(backEnd, pooledConnectString);
+
+            int n1 = 0, n2 = 0;
+            sql1 << "select 1 from dual", soci::into(n1);
+            sql2 << "select 2 from dual", soci::into(n2);
+            CHECK(n1 == 1);
+            CHECK(n2 == 2);
+        }
+
+        CHECK_THROWS_AS(
+            soci::session(backEnd, connectString + " session_pool=-1"),
+            soci::soci_error&);
+    }
+}
+
+TEST_CASE("Oracle prefetch options", "[oracle][prefetch]")
+{
+    soci::session sql(backEnd, connectString
+        + " prefetch_rows=50 prefetch_memory=65536 lob_prefetch_size=4096");
+
+    sql << "create table t (i integer, s clob)";
+
+    for (int i = 0; i != 100; ++i)
+    {
+        // avoid empty strings which are stored as NULL by Oracle
+        std::string const s(static_cast<std::size_t>(i + 1), 'x');
+        sql << "insert into t (i, s) values (:i, :s)",
+            soci::use(i), soci::use(s);
+    }
+
+    // the session defaults are used for the rowset
+    int sum = 0;
+    soci::rowset<int> rs = (sql.prepare << "select i from t");
+    for (soci::rowset<int>::const_iterator it = rs.begin(); it != rs.end(); ++it)
+    {
+        sum += *it;
+    }
+    CHECK(sum == 4950);
+
+    // and they can be overridden for a particular statement
+    int i = 0;
+    soci::long_string s;
+    soci::statement st = (sql.prepare << "select i, s from t order by i",
+        soci::into(i), soci::into(s));
+
+    oracle_statement_backend * backend =
+        static_cast<oracle_statement_backend *>(st.get_backend());
+    backend->set_prefetch_rows(7);
+    backend->set_lob_prefetch_size(10);
+
+    st.execute();
+
+    int count = 0;
+    while (st.fetch())
+    {
+        CHECK(i == count);
+        CHECK(s.value.size() == static_cast<std::size_t>(count + 1));
+        ++count;
+    }
+    CHECK(count == 100);
+
+    sql << "drop table t";
+}
+
+TEST_CASE("Oracle batch errors", "[oracle][bulk][batcherrors]")
+{
+    soci::session sql(backEnd, connectString);
+
+    sql << "create table t (i integer primary key)";
+
+    std::vector<int> v;
+    v.push_back(1);
+    v.push_back(2);
+    v.push_back(1); // duplicate
+    v.push_back(3);
+    v.push_back(2); // duplicate
+
+    SECTION("Disabled")
+    {
+        CHECK_THROWS_AS((sql << "insert into t (i) values (:i)", soci::use(v)),
+            soci::oracle_soci_error&);
+    }
+
+    SECTION("Enabled")
+    {
+        soci::statement st = (sql.prepare << "insert into t (i) values (:i)",
+            soci::use(v));
+
+        oracle_statement_backend * backend =
+            static_cast<oracle_statement_backend *>(st.get_backend());
+        backend->set_batch_errors(true);
+
+        st.execute(true);
+
+        // all the other rows are inserted
+        CHECK(st.get_affected_rows() == 3);
+
+        std::vector<oracle_batch_error> const & errors =
+            backend->get_batch_errors();
+        REQUIRE(errors.size() == 2);
+        CHECK(errors[0].row_ == 2);
+        CHECK(errors[0].err_num_ == 1); // ORA-00001: unique constraint
+        CHECK(errors[1].row_ == 4);
+        CHECK(errors[1].err_num_ == 1);
+
+        int count = 0;
+        sql << "select count(*) from t", soci::into(count);
+        CHECK(count == 3);
+
+        // no errors are reported if all rows succeed
+        sql << "delete from t";
+        v.resize(2);
+        st.execute(true);
+        CHECK(backend->get_batch_errors().empty());
+    }
+
+    sql << "drop table t";
+}
+
 //
 // Support for soci Common Tests
 //
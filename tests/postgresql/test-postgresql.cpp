@@ -378,6 +378,20 @@ TEST_CASE("PostgreSQL dynamic backend", "[postgresql][backend][.]")
         CHECK(backends.empty());
     }
 
+    {
+        dynamic_backends::register_backend("pgsql", backEnd);
+
+        soci::session sql("pgsql://" + connectString);
+
+        // unloading the backend doesn't affect the sessions still using it
+        dynamic_backends::unload("pgsql");
+        CHECK(dynamic_backends::list_all().empty());
+
+        int i = 0;
+        sql << "select 1", into(i);
+        CHECK(i == 1);
+    }
+
     {
         soci::session sql("postgresql://" + connectString);
     }
@@ -458,6 +472,55 @@ TEST_CASE("PostgreSQL datetime", "[postgresql][datetime]")
     CHECK(t3.tm_sec == 3);
 }
 
+TEST_CASE("PostgreSQL timestamp", "[postgresql][timestamp]")
+{
+    soci::session sql(backEnd, connectString);
+
+    // 2009-06-17 22:51:03.123456 UTC
+    timestamp const t1(1245279063123456LL);
+
+    timestamp t2, t3;
+    sql << "select :ts::timestamp with time zone, "
+           "'2009-06-17 22:51:03.5-02'::timestamp with time zone",
+        use(t1, "ts"), into(t2), into(t3);
+    CHECK(t2.microseconds == t1.microseconds);
+    CHECK(t3.microseconds == 1245286263500000LL);
+
+    std::vector<timestamp> v(3);
+    sql << "select (timestamp '2009-06-17 22:51:03.123456' + n * interval '1 second')"
+           " from generate_series(0, 2) n order by n", into(v);
+    REQUIRE(v.size() == 3);
+    CHECK(v[0].microseconds == t1.microseconds);
+    CHECK(v[2].microseconds == t1.microseconds + 2000000LL);
+}
+
+TEST_CASE("PostgreSQL decimal", "[postgresql][decimal]")
+{
+    soci::session sql(backEnd, connectString);
+
+    decimal const d1(-123456789012345678LL, 4);
+
+    decimal d2, d3;
+    sql << "select :d::numeric(30, 4), 0.1::numeric(40, 30)",
+        use(d1, "d"), into(d2), into(d3);
+    CHECK(d2.value == d1.value);
+    CHECK(d2.scale == 4);
+
+    // Trailing zeroes beyond the maximal scale are dropped.
+    CHECK(d3.value == 100000000000000000LL);
+    CHECK(d3.scale == 18);
+
+    std::vector<decimal> v(3);
+    sql << "select n * 1.25 from generate_series(1, 3) n order by n", into(v);
+    REQUIRE(v.size() == 3);
+    CHECK(v[0].value == 125);
+    CHECK(v[0].scale == 2);
+    CHECK(v[2].value == 375);
+    CHECK(v[2].scale == 2);
+
+    CHECK_THROWS_AS((sql << "select 'NaN'::numeric", into(d2)), soci_error&);
+}
+
 // test for number of affected rows
 
 struct table_creator_for_test11 : table_creator_base
@@ -671,6 +734,28 @@ TEST_CASE("PostgreSQL statement prepare failure", "[postgresql][prepare]")
     }
 }
 
+// Test limiting the memory used by the results kept by libpq
+TEST_CASE("PostgreSQL fetch memory limit", "[postgresql][memory-limit]")
+{
+    soci::session sql(backEnd, connectString);
+
+    std::string const query =
+        "select repeat('x', 100) from generate_series(1, 10)";
+
+    std::vector<std::string> rows(10);
+
+    sql.set_fetch_memory_limit(1000);
+    CHECK_THROWS_AS((sql << query, into(rows)), memory_limit_error&);
+    CHECK(sql.get_fetch_memory_used() == 0);
+
+    // The session must remain usable after the error.
+    sql.set_fetch_memory_limit(2000);
+    sql << query, into(rows);
+    CHECK(rows.size() == 10);
+    CHECK(rows[0] == std::string(100, 'x'));
+    CHECK(sql.get_fetch_memory_used() == 0);
+}
+
 // Test the support of PostgreSQL-style casts with ORM
 TEST_CASE("PostgreSQL ORM cast", "[postgresql][orm]")
 {
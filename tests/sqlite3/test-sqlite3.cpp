@@ -7,6 +7,7 @@
 
 #include <soci/soci.h>
 #include <soci/sqlite3/soci-sqlite3.h>
+#include <soci/soci-simple.h>
 #include "common-tests.h"
 #include <iostream>
 #include <sstream>
@@ -237,6 +238,137 @@ TEST_CASE("SQLite vector long long", "[sqlite][vector][longlong]")
     CHECK(v2[4] == 1000000000000LL);
 }
 
+struct timestamp_table_creator : table_creator_base
+{
+    timestamp_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer, ts timestamp)";
+    }
+};
+
+TEST_CASE("SQLite timestamp", "[sqlite][timestamp]")
+{
+    soci::session sql(backEnd, connectString);
+
+    timestamp_table_creator tableCreator(sql);
+
+    // 2009-06-17 22:51:03.123456 UTC
+    timestamp const t1(1245279063123456LL);
+    sql << "insert into soci_test(id, ts) values(1, :ts)", use(t1);
+
+    // Values stored as text, Unix time and Julian day are all understood.
+    sql << "insert into soci_test(id, ts) values(2, 1245279063)";
+    sql << "insert into soci_test(id, ts) values(3, 2440587.5)";
+    sql << "insert into soci_test(id, ts) values(4, '2009-06-17T22:51:03+02:00')";
+
+    timestamp t2;
+    sql << "select ts from soci_test where id = 1", into(t2);
+    CHECK(t2.microseconds == t1.microseconds);
+
+    std::string s;
+    sql << "select ts from soci_test where id = 1", into(s);
+    CHECK(s == "2009-06-17 22:51:03.123456");
+
+    sql << "select ts from soci_test where id = 2", into(t2);
+    CHECK(t2.microseconds == 1245279063000000LL);
+
+    sql << "select ts from soci_test where id = 3", into(t2);
+    CHECK(t2.microseconds == 0);
+
+    sql << "select ts from soci_test where id = 4", into(t2);
+    CHECK(t2.microseconds == 1245271863000000LL);
+
+    std::vector<timestamp> v(10);
+    sql << "select ts from soci_test order by id", into(v);
+    REQUIRE(v.size() == 4);
+    CHECK(v[0].microseconds == t1.microseconds);
+    CHECK(v[1].microseconds == 1245279063000000LL);
+    CHECK(v[2].microseconds == 0);
+    CHECK(v[3].microseconds == 1245271863000000LL);
+
+    sql << "delete from soci_test";
+    std::vector<int> ids;
+    for (int i = 0; i != 4; ++i)
+    {
+        ids.push_back(i + 1);
+    }
+    sql << "insert into soci_test(id, ts) values(:id, :ts)", use(ids), use(v);
+    std::vector<timestamp> v2(10);
+    sql << "select ts from soci_test order by ts", into(v2);
+    REQUIRE(v2.size() == 4);
+    CHECK(v2[0].microseconds == 0);
+    CHECK(v2[3].microseconds == t1.microseconds);
+
+#if defined(SOCI_HAVE_CXX_C11)
+    std::chrono::system_clock::time_point tp;
+    sql << "select ts from soci_test where ts = :ts", use(t1), into(tp);
+    CHECK(std::chrono::duration_cast<std::chrono::microseconds>(
+            tp.time_since_epoch()).count() == t1.microseconds);
+#endif // SOCI_HAVE_CXX_C11
+}
+
+struct decimal_table_creator : table_creator_base
+{
+    decimal_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer, d decimal(20, 2), s text)";
+    }
+};
+
+TEST_CASE("SQLite decimal", "[sqlite][decimal]")
+{
+    soci::session sql(backEnd, connectString);
+
+    decimal_table_creator tableCreator(sql);
+
+    decimal const d1(-1250, 2);
+    sql << "insert into soci_test(id, d, s) values(1, :d, :s)", use(d1), use(d1);
+
+    // NUMERIC affinity stores the value as REAL, which drops the trailing
+    // zero, while the text column keeps it as is.
+    decimal d2, d3;
+    sql << "select d, s from soci_test where id = 1", into(d2), into(d3);
+    CHECK(d2.value == -125);
+    CHECK(d2.scale == 1);
+    CHECK(d3.value == -1250);
+    CHECK(d3.scale == 2);
+
+    // Big integer values don't lose precision.
+    sql << "insert into soci_test(id, d, s) values(2, 1234567890123456789, '0.001')";
+    sql << "select d, s from soci_test where id = 2", into(d2), into(d3);
+    CHECK(d2.value == 1234567890123456789LL);
+    CHECK(d2.scale == 0);
+    CHECK(d3.value == 1);
+    CHECK(d3.scale == 3);
+
+    std::vector<decimal> v(10);
+    sql << "select s from soci_test order by id", into(v);
+    REQUIRE(v.size() == 2);
+    CHECK(v[0].value == -1250);
+    CHECK(v[0].scale == 2);
+    CHECK(v[1].value == 1);
+    CHECK(v[1].scale == 3);
+
+    sql << "delete from soci_test";
+
+    std::vector<int> ids;
+    ids.push_back(1);
+    ids.push_back(2);
+    sql << "insert into soci_test(id, s) values(:id, :s)", use(ids), use(v);
+
+    std::vector<std::string> strings(10);
+    sql << "select s from soci_test order by id", into(strings);
+    REQUIRE(strings.size() == 2);
+    CHECK(strings[0] == "-12.50");
+    CHECK(strings[1] == "0.001");
+
+    sql << "update soci_test set s = 'not a number' where id = 1";
+    CHECK_THROWS_AS((sql << "select s from soci_test where id = 1", into(d2)),
+                    soci_error&);
+}
+
 TEST_CASE("SQLite DDL wrappers", "[sqlite][ddl]")
 {
     soci::session sql(backEnd, connectString);
@@ -272,6 +404,273 @@ TEST_CASE("SQLite last insert id", "[sqlite][last-insert-id]")
     CHECK(id == 42);
 }
 
+// The type of the columns without a known declared type depends on their
+// data, so the previously described type must not be reused after it changes
+TEST_CASE("SQLite dynamic row type depending on data", "[sqlite][dynamic]")
+{
+    soci::session sql(backEnd, connectString);
+
+    try { sql << "drop table soci_test"; }
+    catch (soci_error const &) {} // ignore if error
+
+    sql << "create table soci_test(val unknown_type)";
+
+    std::string const query = "select val from soci_test";
+
+    {
+        row r;
+        sql << query, into(r);
+        CHECK(!sql.got_data());
+        REQUIRE(r.size() == 1);
+        CHECK(r.get_properties(0).get_data_type() == dt_string);
+    }
+
+    sql << "insert into soci_test(val) values(17)";
+
+    {
+        row r;
+        sql << query, into(r);
+        REQUIRE(r.size() == 1);
+        CHECK(r.get_properties(0).get_data_type() == dt_integer);
+        CHECK(r.get<int>(0) == 17);
+    }
+
+    sql << "drop table soci_test";
+}
+
+TEST_CASE("SQLite fetch memory limit", "[sqlite][memory-limit]")
+{
+    soci::session sql(backEnd, connectString);
+
+    try { sql << "drop table soci_test"; }
+    catch (soci_error const &) {} // ignore if error
+
+    sql << "create table soci_test(name varchar(100))";
+
+    std::string const name(100, 'x');
+    for (int i = 0; i != 10; ++i)
+    {
+        sql << "insert into soci_test(name) values(:name)", use(name);
+    }
+
+    std::vector<std::string> names(10);
+
+    // The strings alone need more than 1000 bytes.
+    sql.set_fetch_memory_limit(1000);
+    CHECK_THROWS_AS((sql << "select name from soci_test", into(names)),
+                    memory_limit_error&);
+    CHECK(sql.get_fetch_memory_used() == 0);
+
+    sql.set_fetch_memory_limit(2000);
+    sql << "select name from soci_test", into(names);
+    CHECK(names.size() == 10);
+    CHECK(names[9] == name);
+    CHECK(sql.get_fetch_memory_used() == 0);
+
+    {
+        // Two statements fetching 5 rows each fit into the per statement
+        // limit but not into the session one.
+        sql.set_fetch_memory_limit(1000, 1000);
+
+        std::vector<std::string> names1(5), names2(5);
+        statement st1 = (sql.prepare << "select name from soci_test", into(names1));
+        statement st2 = (sql.prepare << "select name from soci_test", into(names2));
+
+        st1.execute(true);
+        CHECK(names1.size() == 5);
+        CHECK(sql.get_fetch_memory_used() > 500);
+
+        try
+        {
+            st2.execute(true);
+            FAIL("exception expected");
+        }
+        catch (memory_limit_error const& e)
+        {
+            CHECK(e.get_error_category() == soci_error::limit_exceeded);
+        }
+
+        sql.set_fetch_memory_limit(0);
+        st2.execute(true);
+        CHECK(names2.size() == 5);
+    }
+
+    sql << "drop table soci_test";
+}
+
+#ifndef SOCI_TESTS_STATIC
+
+// Loading the backend from its shared library and unloading it while it is
+// still used by a session
+TEST_CASE("SQLite dynamic backend", "[sqlite][backend]")
+{
+    dynamic_backends::register_backend("sqlite3");
+
+    std::vector<std::string> backends = dynamic_backends::list_all();
+    CHECK(std::find(backends.begin(), backends.end(), "sqlite3")
+            != backends.end());
+
+    {
+        soci::session sql("sqlite3://:memory:");
+
+        // the library is closed only when the session doesn't use it any more
+        dynamic_backends::unload("sqlite3");
+
+        backends = dynamic_backends::list_all();
+        CHECK(std::find(backends.begin(), backends.end(), "sqlite3")
+                == backends.end());
+
+        int i = 0;
+        sql << "select 17", into(i);
+        CHECK(i == 17);
+    }
+
+    // the backend is loaded again when it's needed
+    {
+        soci::session sql("sqlite3://:memory:");
+
+        int i = 0;
+        sql << "select 42", into(i);
+        CHECK(i == 42);
+    }
+
+    dynamic_backends::unload("sqlite3");
+}
+
+#endif // !SOCI_TESTS_STATIC
+
+TEST_CASE("SQLite C API", "[sqlite][simple]")
+{
+    // The C API can only open sessions by backend name, so make the backend
+    // available under a name even when it is linked statically.
+    dynamic_backends::register_backend("sqlite3_c_api", backEnd);
+
+    session_handle const sql =
+        soci_create_session(("sqlite3_c_api://" + connectString).c_str());
+    REQUIRE(sql != NULL);
+    REQUIRE(soci_session_state(sql) == 1);
+
+    statement_handle st = soci_create_statement(sql);
+    soci_prepare(st, "create table soci_test(id integer, name varchar(20), "
+                     "code integer)");
+    soci_execute(st, 1);
+    REQUIRE(soci_statement_state(st) == 1);
+    soci_destroy_statement(st);
+
+    SECTION("Single elements")
+    {
+        st = soci_create_statement(sql);
+        soci_use_int(st, "id");
+        soci_use_string(st, "name");
+        soci_use_long_long(st, "code");
+        soci_set_use_int(st, "id", 1);
+        soci_set_use_string(st, "name", "one");
+        soci_set_use_long_long(st, "code", 10000000000LL);
+        soci_prepare(st, "insert into soci_test(id, name, code) "
+                         "values(:id, :name, :code)");
+        soci_execute(st, 1);
+        REQUIRE(soci_statement_state(st) == 1);
+
+        soci_set_use_int(st, "id", 2);
+        soci_set_use_state(st, "name", 0);
+        soci_set_use_state(st, "code", 0);
+        soci_execute(st, 1);
+        REQUIRE(soci_statement_state(st) == 1);
+        CHECK(soci_get_use_int(st, "id") == 2);
+        CHECK(soci_get_use_state(st, "name") == 0);
+        soci_destroy_statement(st);
+
+        st = soci_create_statement(sql);
+        int const name = soci_into_string(st);
+        int const code = soci_into_long_long(st);
+        soci_prepare(st, "select name, code from soci_test order by id");
+        CHECK(soci_execute(st, 1) == 1);
+        CHECK(soci_get_into_state(st, name) == 1);
+        CHECK(std::string(soci_get_into_string(st, name)) == "one");
+        CHECK(soci_get_into_long_long(st, code) == 10000000000LL);
+
+        CHECK(soci_fetch(st) == 1);
+        CHECK(soci_get_into_state(st, name) == 0);
+        CHECK(soci_get_into_state(st, code) == 0);
+
+        // reading a null element is an error
+        soci_get_into_long_long(st, code);
+        CHECK(soci_statement_state(st) == 0);
+
+        CHECK(soci_fetch(st) == 0);
+        soci_destroy_statement(st);
+    }
+
+    SECTION("Bulk buffers")
+    {
+        int const ids[] = { 1, 2, 3 };
+        char const * const names[] = { "one", NULL, "three" };
+        long long const codes[] = { 100, 0, 300 };
+        int const codeStates[] = { 1, 0, 1 };
+
+        st = soci_create_statement(sql);
+        soci_use_int_v(st, "id");
+        soci_use_string_v(st, "name");
+        soci_use_long_long_v(st, "code");
+        soci_use_resize_v(st, 3);
+        CHECK(soci_set_use_ints_v(st, "id", ids, 3) == 3);
+        CHECK(soci_set_use_strings_v(st, "name", names, 3) == 3);
+        CHECK(soci_set_use_long_longs_v(st, "code", codes, 3) == 3);
+        CHECK(soci_set_use_states_v(st, "code", codeStates, 3) == 3);
+        soci_prepare(st, "insert into soci_test(id, name, code) "
+                         "values(:id, :name, :code)");
+        soci_execute(st, 1);
+        REQUIRE(soci_statement_state(st) == 1);
+        soci_destroy_statement(st);
+
+        st = soci_create_statement(sql);
+        int const id = soci_into_int_v(st);
+        int const name = soci_into_string_v(st);
+        int const code = soci_into_long_long_v(st);
+        soci_into_resize_v(st, 10);
+        soci_prepare(st, "select id, name, code from soci_test order by id");
+        CHECK(soci_execute(st, 1) == 1);
+        REQUIRE(soci_into_get_size_v(st) == 3);
+
+        int const * const idBuf = soci_get_into_int_buffer_v(st, id);
+        REQUIRE(idBuf != NULL);
+        CHECK(idBuf[0] == 1);
+        CHECK(idBuf[2] == 3);
+
+        char const * namesOut[3];
+        REQUIRE(soci_get_into_strings_v(st, name, namesOut, 3) == 3);
+        REQUIRE(namesOut[0] != NULL);
+        CHECK(std::string(namesOut[0]) == "one");
+        CHECK(namesOut[1] == NULL);
+        REQUIRE(namesOut[2] != NULL);
+        CHECK(std::string(namesOut[2]) == "three");
+
+        int states[3];
+        REQUIRE(soci_get_into_states_v(st, code, states, 3) == 3);
+        CHECK(states[0] == 1);
+        CHECK(states[1] == 0);
+        CHECK(states[2] == 1);
+
+        long long const * const codeBuf =
+            soci_get_into_long_long_buffer_v(st, code);
+        REQUIRE(codeBuf != NULL);
+        CHECK(codeBuf[0] == 100);
+        CHECK(codeBuf[2] == 300);
+
+        // the buffer accessors check the element type
+        CHECK(soci_get_into_double_buffer_v(st, code) == NULL);
+        CHECK(soci_statement_state(st) == 0);
+        soci_destroy_statement(st);
+    }
+
+    st = soci_create_statement(sql);
+    soci_prepare(st, "drop table soci_test");
+    soci_execute(st, 1);
+    soci_destroy_statement(st);
+
+    soci_destroy_session(sql);
+}
+
 // DDL Creation objects for common tests
 struct table_creator_one : public table_creator_base
 {